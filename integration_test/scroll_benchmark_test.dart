@@ -0,0 +1,182 @@
+// Scroll benchmarks for the desktop build.
+//
+// Run on Linux with:
+//   flutter drive --profile -d linux \
+//     --dart-define=ANIGEN_FIXTURES=$PWD/test/fixtures \
+//     --driver=test_driver/perf_driver.dart \
+//     --target=integration_test/scroll_benchmark_test.dart
+//
+// Data and posters come from test/fixtures through MockUpstreamServer, so runs
+// are comparable. Frame timings are written to build/benchmarks/.
+
+import 'dart:io';
+
+import 'package:anigen/main.dart';
+import 'package:anigen/screens/details_screen.dart';
+import 'package:anigen/screens/home_screen.dart';
+import 'package:anigen/screens/search_screen.dart';
+import 'package:flutter/material.dart';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:google_fonts/google_fonts.dart';
+import 'package:integration_test/integration_test.dart';
+
+import '../test/support/mock_upstream_http_overrides.dart';
+import '../test/support/mock_upstream_server.dart';
+import '../test/support/upstream_redirect_client.dart';
+
+const _fixturesDir = String.fromEnvironment(
+  'ANIGEN_FIXTURES',
+  defaultValue: 'test/fixtures',
+);
+
+void main() {
+  final binding = IntegrationTestWidgetsFlutterBinding.ensureInitialized();
+  binding.framePolicy = LiveTestWidgetsFlutterBindingFramePolicy.fullyLive;
+
+  late MockUpstreamServer server;
+
+  setUpAll(() async {
+    // Fall back to the bundled font instead of fetching from fonts.gstatic.com.
+    GoogleFonts.config.allowRuntimeFetching = false;
+    server = await MockUpstreamServer.start(fixturesDir: _fixturesDir);
+    HttpOverrides.global = MockUpstreamHttpOverrides(server.port);
+  });
+
+  tearDownAll(() async {
+    HttpOverrides.global = null;
+    await server.close();
+  });
+
+  testWidgets('home rows', (tester) async {
+    await withMockUpstream(server, () async {
+      await _launch(tester);
+
+      final rows = find.descendant(
+        of: find.byType(HomeContentScreen),
+        matching: find.byWidgetPredicate(
+          (w) => w is ListView && w.scrollDirection == Axis.horizontal,
+        ),
+      );
+      expect(rows, findsWidgets);
+
+      await binding.traceAction(() async {
+        final count = rows.evaluate().length;
+        for (var r = 0; r < count; r++) {
+          final finder = rows.at(r);
+          for (var i = 0; i < 3; i++) {
+            await tester.fling(finder, const Offset(-600, 0), 2500);
+            await _idle(tester);
+          }
+          for (var i = 0; i < 3; i++) {
+            await tester.fling(finder, const Offset(600, 0), 2500);
+            await _idle(tester);
+          }
+        }
+      }, reportKey: 'home_rows');
+    });
+  });
+
+  testWidgets('genre grid', (tester) async {
+    await withMockUpstream(server, () async {
+      await _launch(tester);
+
+      final chip = find.widgetWithText(ActionChip, 'Action');
+      await tester.scrollUntilVisible(
+        chip,
+        300,
+        scrollable: find
+            .descendant(
+              of: find.byType(HomeContentScreen),
+              matching: find.byType(Scrollable),
+            )
+            .first,
+      );
+      await tester.tap(chip);
+      await _pumpUntilFound(tester, find.byType(GridView));
+      await _pumpUntilFound(
+        tester,
+        find.descendant(of: find.byType(GridView), matching: find.byType(Image)),
+      );
+
+      final grid = find.byType(GridView);
+      await binding.traceAction(() async {
+        for (var i = 0; i < 4; i++) {
+          await tester.fling(grid, const Offset(0, -500), 3000);
+          await _idle(tester);
+        }
+        for (var i = 0; i < 4; i++) {
+          await tester.fling(grid, const Offset(0, 500), 3000);
+          await _idle(tester);
+        }
+      }, reportKey: 'genre_grid');
+    });
+  });
+
+  testWidgets('long episode list', (tester) async {
+    await withMockUpstream(server, () async {
+      await _launch(tester);
+
+      await tester.tap(find.byIcon(Icons.search_outlined));
+      await tester.pump();
+      await tester.enterText(find.byType(TextField), 'one piece');
+      // Hidden tabs stay in the tree, so scope lookups to the visible screen.
+      final result = find.descendant(
+        of: find.byType(SearchScreen),
+        matching: find.widgetWithText(ListTile, 'One Piece'),
+      );
+      await _pumpUntilFound(tester, result);
+      await tester.tap(result);
+      await _pumpUntilFound(tester, find.textContaining('episodes available'));
+
+      final list = find.descendant(
+        of: find.byType(DetailsScreen),
+        matching: find.byType(ListView),
+      );
+      await binding.traceAction(() async {
+        for (var i = 0; i < 8; i++) {
+          await tester.fling(list, const Offset(0, -800), 5000);
+          await _idle(tester);
+        }
+        for (var i = 0; i < 8; i++) {
+          await tester.fling(list, const Offset(0, 800), 5000);
+          await _idle(tester);
+        }
+      }, reportKey: 'episode_list');
+    });
+  });
+}
+
+Future<void> _launch(WidgetTester tester) async {
+  await tester.pumpWidget(const AnigenApp());
+  await _pumpUntilFound(
+    tester,
+    find.descendant(
+      of: find.byType(HomeContentScreen),
+      matching: find.byType(Image),
+    ),
+  );
+  await _idle(tester);
+}
+
+/// Pumps frames until [finder] matches; `pumpAndSettle` never returns while a
+/// progress indicator is spinning.
+Future<void> _pumpUntilFound(
+  WidgetTester tester,
+  Finder finder, {
+  Duration timeout = const Duration(seconds: 20),
+}) async {
+  final sw = Stopwatch()..start();
+  while (finder.evaluate().isEmpty) {
+    if (sw.elapsed > timeout) {
+      throw TestFailure('Timed out waiting for $finder');
+    }
+    await tester.pump(const Duration(milliseconds: 50));
+  }
+}
+
+/// Lets a fling come to rest without waiting on unrelated animations.
+Future<void> _idle(WidgetTester tester) async {
+  for (var i = 0; i < 30; i++) {
+    await tester.pump(const Duration(milliseconds: 16));
+  }
+}
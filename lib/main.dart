@@ -4,6 +4,16 @@ import 'package:flutter/services.dart';
 import 'package:media_kit/media_kit.dart';
 import 'package:google_fonts/google_fonts.dart';
 import 'package:anigen/screens/home_screen.dart';
+import 'package:anigen/services/catalog_index.dart';
+import 'package:anigen/services/episode_watcher.dart';
+import 'package:anigen/services/resource_monitor.dart';
+import 'package:anigen/widgets/resource_hud.dart';
+
+// Linux resource monitoring, off by default:
+//   flutter run -d linux --dart-define=ANIGEN_RESOURCE_HUD=true
+// Add --dart-define=ANIGEN_RESOURCE_CSV=true to also log samples to CSV.
+const bool _resourceHud = bool.fromEnvironment('ANIGEN_RESOURCE_HUD');
+const bool _resourceCsv = bool.fromEnvironment('ANIGEN_RESOURCE_CSV');
 
 // Custom HTTP client to handle certificate issues on Windows
 class MyHttpOverrides extends HttpOverrides {
@@ -29,7 +39,17 @@ void main() {
     ),
   );
   
+  // Restore the local title index used for instant search results
+  CatalogIndex.instance.load();
+
   runApp(const AnigenApp());
+
+  // Look for new episodes of recently watched shows in the background
+  EpisodeWatcher.instance.start();
+
+  if (_resourceHud || _resourceCsv) {
+    ResourceMonitor.instance.start(exportCsv: _resourceCsv);
+  }
 }
 
 class AnigenApp extends StatelessWidget {
@@ -130,6 +150,9 @@ class AnigenApp extends StatelessWidget {
           color: mauve,
         ),
       ),
+      builder: _resourceHud
+          ? (context, child) => ResourceHud(child: child!)
+          : null,
       home: const HomeScreen(),
     );
   }
@@ -15,4 +15,9 @@ class Episode {
   final String url;
 
   Episode({required this.number, required this.url});
+
+  List<dynamic> toJson() => [number, url];
+
+  factory Episode.fromJson(List<dynamic> json) =>
+      Episode(number: json[0] as String, url: json[1] as String);
 }
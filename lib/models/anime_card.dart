@@ -0,0 +1,71 @@
+import 'package:flutter/foundation.dart';
+import 'package:jikan_api/jikan_api.dart' as jikan;
+
+/// The part of a Jikan anime a poster card shows.
+///
+/// Feeds keep these instead of full `jikan_api` models, which carry synopsis,
+/// trailers, producers and more. Cards are interned by [malId], so a title
+/// listed in several sections is held once.
+@immutable
+class AnimeCard {
+  final int malId;
+  final String title;
+  final String? imageUrl;
+
+  // Weak, so dropping a feed releases its cards. The finalizer then drops
+  // the map entry, unless a newer card has taken its place.
+  static final Map<int, WeakReference<AnimeCard>> _interned = {};
+  static final Finalizer<int> _finalizer = Finalizer((malId) {
+    if (_interned[malId]?.target == null) _interned.remove(malId);
+  });
+
+  const AnimeCard._(this.malId, this.title, this.imageUrl);
+
+  factory AnimeCard({
+    required int malId,
+    required String title,
+    String? imageUrl,
+  }) {
+    final existing = _interned[malId]?.target;
+    if (existing != null &&
+        existing.title == title &&
+        existing.imageUrl == imageUrl) {
+      return existing;
+    }
+    final card = AnimeCard._(malId, title, imageUrl);
+    _interned[malId] = WeakReference(card);
+    _finalizer.attach(card, malId);
+    return card;
+  }
+
+  factory AnimeCard.fromJikan(jikan.Anime anime) => AnimeCard(
+        malId: anime.malId,
+        title: anime.title ?? 'Unknown',
+        imageUrl: anime.imageUrl,
+      );
+
+  static List<AnimeCard> fromJikanList(Iterable<jikan.Anime> anime) =>
+      List.unmodifiable(anime.map(AnimeCard.fromJikan));
+
+  Map<String, dynamic> toJson() => {
+        'mal_id': malId,
+        'title': title,
+        'image_url': imageUrl,
+      };
+
+  factory AnimeCard.fromJson(Map<String, dynamic> json) => AnimeCard(
+        malId: json['mal_id'] as int,
+        title: json['title'] as String,
+        imageUrl: json['image_url'] as String?,
+      );
+
+  @override
+  bool operator ==(Object other) =>
+      other is AnimeCard &&
+      other.malId == malId &&
+      other.title == title &&
+      other.imageUrl == imageUrl;
+
+  @override
+  int get hashCode => Object.hash(malId, title, imageUrl);
+}
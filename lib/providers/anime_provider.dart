@@ -1,6 +1,7 @@
 import 'dart:convert';
 import 'package:http/http.dart' as http;
 import '../models/anime.dart';
+import '../services/hedged_requests.dart';
 
 class AnimeProvider {
   static const String _allAnimeBase = "allanime.day";
@@ -9,6 +10,11 @@ class AnimeProvider {
   static const String _agent =
       "Mozilla/5.0 (Windows NT 10.0; Win64; x64; rv:109.0) Gecko/20100101 Firefox/121.0";
 
+  final HedgedRequests _requests;
+
+  AnimeProvider({HedgedRequests? requests})
+      : _requests = requests ?? HedgedRequests.instance;
+
   Future<List<Anime>> search(String query) async {
     const String searchGql = r'''
       query( $search: SearchInput $limit: Int $page: Int $translationType: VaildTranslationTypeEnumType $countryOrigin: VaildCountryOriginEnumType ) {
@@ -27,7 +33,8 @@ class AnimeProvider {
       "countryOrigin": "ALL",
     };
 
-    final http.Response response = await http.get(
+    final http.Response response = await _requests.get(
+      EndpointClass.search,
       url.replace(
         queryParameters: {
           "variables": jsonEncode(variables),
@@ -63,7 +70,8 @@ class AnimeProvider {
     final Uri url = Uri.parse("$_allAnimeApi/api");
     final Map<String, dynamic> variables = {"showId": animeId};
 
-    final http.Response response = await http.get(
+    final http.Response response = await _requests.get(
+      EndpointClass.episodes,
       url.replace(
         queryParameters: {
           "variables": jsonEncode(variables),
@@ -75,33 +83,78 @@ class AnimeProvider {
 
     if (response.statusCode == 200) {
       final Map<String, dynamic> data = jsonDecode(response.body);
-      final Map<String, dynamic> details =
-          data['data']['show']['availableEpisodesDetail'];
-
-      // Extract 'sub' episodes
-      final List<dynamic> subEpisodes = details['sub'] ?? [];
-
-      // Sort episodes numerically if possible, otherwise keep order
-      subEpisodes.sort((a, b) {
-        try {
-          return double.parse(a).compareTo(double.parse(b));
-        } catch (e) {
-          return 0;
-        }
-      });
+      return _parseEpisodes(data['data']['show']['availableEpisodesDetail']);
+    } else {
+      throw Exception('Failed to get episodes');
+    }
+  }
 
-      return subEpisodes.map((ep) {
-        return Episode(
-          number: ep.toString(),
-          url: ep
-              .toString(), // Episode number serves as identifier for fetching link
-        );
-      }).toList();
+  /// Fetches the episode lists of several shows in one request, using a
+  /// GraphQL alias per show. Shows missing from the response are omitted.
+  Future<Map<String, List<Episode>>> getEpisodesBatch(
+    List<String> animeIds,
+  ) async {
+    if (animeIds.isEmpty) return {};
+
+    final params = <String>[];
+    final fields = <String>[];
+    final Map<String, dynamic> variables = {};
+    for (var i = 0; i < animeIds.length; i++) {
+      params.add('\$id$i: String!');
+      fields.add('s$i: show( _id: \$id$i ) { _id availableEpisodesDetail }');
+      variables['id$i'] = animeIds[i];
+    }
+    final String batchGql =
+        'query (${params.join(', ')}) { ${fields.join(' ')} }';
+
+    final Uri url = Uri.parse("$_allAnimeApi/api");
+    final http.Response response = await _requests.get(
+      EndpointClass.episodesBatch,
+      url.replace(
+        queryParameters: {
+          "variables": jsonEncode(variables),
+          "query": batchGql,
+        },
+      ),
+      headers: {"User-Agent": _agent, "Referer": _allAnimeRefr},
+    );
+
+    if (response.statusCode == 200) {
+      final Map<String, dynamic> data = jsonDecode(response.body)['data'] ?? {};
+      final Map<String, List<Episode>> result = {};
+      for (var i = 0; i < animeIds.length; i++) {
+        final show = data['s$i'];
+        if (show == null || show['availableEpisodesDetail'] == null) continue;
+        result[animeIds[i]] = _parseEpisodes(show['availableEpisodesDetail']);
+      }
+      return result;
     } else {
       throw Exception('Failed to get episodes');
     }
   }
 
+  List<Episode> _parseEpisodes(Map<String, dynamic> details) {
+    // Extract 'sub' episodes
+    final List<dynamic> subEpisodes = List.of(details['sub'] ?? []);
+
+    // Sort episodes numerically if possible, otherwise keep order
+    subEpisodes.sort((a, b) {
+      try {
+        return double.parse(a).compareTo(double.parse(b));
+      } catch (e) {
+        return 0;
+      }
+    });
+
+    return subEpisodes.map((ep) {
+      return Episode(
+        number: ep.toString(),
+        url: ep
+            .toString(), // Episode number serves as identifier for fetching link
+      );
+    }).toList();
+  }
+
   Future<Map<String, String>?> getStreamLink(
     String animeId,
     String episodeNumber,
@@ -121,7 +174,8 @@ class AnimeProvider {
       "episodeString": episodeNumber,
     };
 
-    final http.Response response = await http.get(
+    final http.Response response = await _requests.get(
+      EndpointClass.streamLink,
       url.replace(
         queryParameters: {
           "variables": jsonEncode(variables),
@@ -189,7 +243,8 @@ class AnimeProvider {
           try {
             final Uri fetchUrl = Uri.parse("https://$_allAnimeBase$sourceUrl");
 
-            final http.Response streamResponse = await http.get(
+            final http.Response streamResponse = await _requests.get(
+              EndpointClass.clock,
               fetchUrl,
               headers: {"User-Agent": _agent, "Referer": _allAnimeRefr},
             );
@@ -298,7 +353,9 @@ class AnimeProvider {
           ..followRedirects = false
           ..headers.addAll({"User-Agent": _agent, "Referer": _allAnimeRefr});
 
-        final response = await client.send(request);
+        final response = await client.send(request).timeout(
+              _requests.policyFor(EndpointClass.redirect).timeout,
+            );
 
         if (response.statusCode >= 300 && response.statusCode < 400) {
           final location = response.headers['location'];
@@ -1,11 +1,32 @@
 import 'package:jikan_api/jikan_api.dart';
+import '../services/hedged_requests.dart';
 
 class JikanProvider {
   final Jikan _jikan = Jikan();
 
+  // Foreground requests currently in flight across all providers; background
+  // prefetching waits for this to drop to zero.
+  static int _inFlight = 0;
+
+  static int get inFlight => _inFlight;
+
+  Future<T> _foreground<T>(Future<T> Function() request) async {
+    _inFlight++;
+    try {
+      return await _withTimeout(request());
+    } finally {
+      _inFlight--;
+    }
+  }
+
+  // jikan_api gives no way to abort a request; a timed-out call is abandoned
+  // and its late response dropped.
+  Future<T> _withTimeout<T>(Future<T> request) => request
+      .timeout(HedgedRequests.instance.policyFor(EndpointClass.jikan).timeout);
+
   Future<List<Anime>> getTopAnime({int page = 1}) async {
     try {
-      final response = await _jikan.getTopAnime(page: page);
+      final response = await _foreground(() => _jikan.getTopAnime(page: page));
       return response;
     } catch (e) {
       throw Exception('Failed to fetch top anime: $e');
@@ -16,10 +37,12 @@ class JikanProvider {
     try {
       final now = DateTime.now();
       final season = _getSeason(now.month);
-      final response = await _jikan.getSeason(
-        year: now.year,
-        season: season,
-        page: page,
+      final response = await _foreground(
+        () => _jikan.getSeason(
+          year: now.year,
+          season: season,
+          page: page,
+        ),
       );
       return response;
     } catch (e) {
@@ -29,9 +52,11 @@ class JikanProvider {
 
   Future<List<Anime>> getPopularAnime({int page = 1}) async {
     try {
-      final response = await _jikan.getTopAnime(
-        page: page,
-        filter: TopFilter.bypopularity,
+      final response = await _foreground(
+        () => _jikan.getTopAnime(
+          page: page,
+          filter: TopFilter.bypopularity,
+        ),
       );
       return response;
     } catch (e) {
@@ -41,7 +66,7 @@ class JikanProvider {
 
   Future<List<Anime>> getUpcomingAnime({int page = 1}) async {
     try {
-      final response = await _jikan.getSeasonUpcoming(page: page);
+      final response = await _foreground(() => _jikan.getSeasonUpcoming(page: page));
       return response;
     } catch (e) {
       throw Exception('Failed to fetch upcoming anime: $e');
@@ -52,9 +77,11 @@ class JikanProvider {
     try {
       final now = DateTime.now();
       final weekday = _getWeekday(now.weekday);
-      final response = await _jikan.getSchedules(
-        weekday: weekday,
-        page: page,
+      final response = await _foreground(
+        () => _jikan.getSchedules(
+          weekday: weekday,
+          page: page,
+        ),
       );
       return response;
     } catch (e) {
@@ -64,16 +91,28 @@ class JikanProvider {
 
   Future<String> getAnimeMoreInfo(int malId) async {
     try {
-      final response = await _jikan.getAnimeMoreInfo(malId);
+      final response = await _foreground(() => _jikan.getAnimeMoreInfo(malId));
       return response;
     } catch (e) {
       throw Exception('Failed to fetch anime info: $e');
     }
   }
 
+  /// Full details for one title. [background] requests are not counted as
+  /// foreground traffic, so they never hold back prefetching.
+  Future<Anime> getAnime(int malId, {bool background = false}) async {
+    try {
+      if (background) return await _withTimeout(_jikan.getAnime(malId));
+      final response = await _foreground(() => _jikan.getAnime(malId));
+      return response;
+    } catch (e) {
+      throw Exception('Failed to fetch anime: $e');
+    }
+  }
+
   Future<List<Genre>> getAnimeGenres() async {
     try {
-      final response = await _jikan.getAnimeGenres();
+      final response = await _foreground(() => _jikan.getAnimeGenres());
       return response;
     } catch (e) {
       throw Exception('Failed to fetch genres: $e');
@@ -87,11 +126,13 @@ class JikanProvider {
       
       // Fetch multiple pages to get enough anime for the genre, sorted by score
       while (allAnime.length < 50 && page <= 3) {
-        final response = await _jikan.searchAnime(
-          genres: [genreId],
-          orderBy: 'score',
-          sort: 'desc',
-          page: page,
+        final response = await _foreground(
+          () => _jikan.searchAnime(
+            genres: [genreId],
+            orderBy: 'score',
+            sort: 'desc',
+            page: page,
+          ),
         );
         
         if (response.isEmpty) break;
@@ -1,5 +1,6 @@
 import 'package:flutter/material.dart';
 import 'package:jikan_api/jikan_api.dart';
+import 'package:anigen/services/anime_info_prefetcher.dart';
 
 class AnimeInfoScreen extends StatefulWidget {
   final int malId;
@@ -25,7 +26,13 @@ class _AnimeInfoScreenState extends State<AnimeInfoScreen> {
   @override
   void initState() {
     super.initState();
-    _loadAnimeInfo();
+    final cached = AnimeInfoPrefetcher.instance.cached(widget.malId);
+    if (cached != null) {
+      _animeData = cached;
+      _isLoading = false;
+    } else {
+      _loadAnimeInfo();
+    }
   }
 
   Future<void> _loadAnimeInfo() async {
@@ -35,14 +42,15 @@ class _AnimeInfoScreenState extends State<AnimeInfoScreen> {
     });
 
     try {
-      final jikan = Jikan();
-      final anime = await jikan.getAnime(widget.malId);
-      
+      final anime = await AnimeInfoPrefetcher.instance.load(widget.malId);
+      if (!mounted) return;
+
       setState(() {
         _animeData = anime;
         _isLoading = false;
       });
     } catch (e) {
+      if (!mounted) return;
       setState(() {
         _error = e.toString();
         _isLoading = false;
@@ -1,7 +1,10 @@
+import 'dart:math';
 import 'package:flutter/material.dart';
 import 'package:anigen/models/anime.dart';
 import 'package:anigen/providers/anime_provider.dart';
 import 'package:anigen/screens/player_screen.dart';
+import 'package:anigen/services/episode_cache.dart';
+import 'package:anigen/services/episode_watcher.dart';
 
 class DetailsScreen extends StatefulWidget {
   final Anime anime;
@@ -13,28 +16,85 @@ class DetailsScreen extends StatefulWidget {
 }
 
 class _DetailsScreenState extends State<DetailsScreen> {
+  // Fixed tile height, so the range index can jump without building tiles.
+  static const double _tileExtent = 64;
+  static const int _rangeSize = 100;
+  // Lists refreshed this recently, usually by the watcher, are not refetched.
+  static const Duration _freshFor = Duration(minutes: 5);
+
   final AnimeProvider _provider = AnimeProvider();
+  final ScrollController _scrollController = ScrollController();
   List<Episode> _episodes = [];
   bool _isLoading = true;
+  bool _isRefreshing = false;
 
   @override
   void initState() {
     super.initState();
+    final cached = EpisodeCache.instance.peek(widget.anime.url);
+    if (cached != null) {
+      _episodes = List.of(cached);
+      _isLoading = false;
+    }
     _fetchEpisodes();
   }
 
+  @override
+  void dispose() {
+    _scrollController.dispose();
+    super.dispose();
+  }
+
   void _fetchEpisodes() async {
+    final cache = EpisodeCache.instance;
+    final animeId = widget.anime.url;
+
+    if (_isLoading) {
+      // Render the last known list from disk, then revalidate.
+      final stored = await cache.read(animeId);
+      if (!mounted) return;
+      if (stored != null) {
+        setState(() {
+          _episodes = List.of(stored);
+          _isLoading = false;
+        });
+      }
+    }
+
+    final fetchedAt = cache.fetchedAt(animeId);
+    if (fetchedAt != null && DateTime.now().difference(fetchedAt) < _freshFor) {
+      EpisodeWatcher.instance.markSeen(animeId, _episodes.length);
+      return;
+    }
+
+    setState(() {
+      _isRefreshing = true;
+    });
     try {
-      final episodes = await _provider.getEpisodes(widget.anime.url);
+      final episodes = await _provider.getEpisodes(animeId);
+      cache.write(animeId, episodes);
+      EpisodeWatcher.instance.markSeen(animeId, episodes.length);
+      if (!mounted) return;
+      final added = EpisodeCache.appended(_episodes, episodes);
       setState(() {
-        _episodes = episodes;
+        if (added != null) {
+          // Usually one new episode at the end; keep the existing tiles. A new
+          // list, since an open player holds the old one as allEpisodes.
+          if (added.isNotEmpty) _episodes = [..._episodes, ...added];
+        } else {
+          _episodes = List.of(episodes);
+        }
         _isLoading = false;
+        _isRefreshing = false;
       });
     } catch (e) {
+      if (!mounted) return;
       setState(() {
         _isLoading = false;
+        _isRefreshing = false;
       });
-      if (mounted) {
+      // A cached list is still usable; only complain when there is none.
+      if (_episodes.isEmpty) {
         ScaffoldMessenger.of(context).showSnackBar(
           SnackBar(content: Text('Error fetching episodes: $e')),
         );
@@ -42,6 +102,35 @@ class _DetailsScreenState extends State<DetailsScreen> {
     }
   }
 
+  void _jumpToEpisode(int index) {
+    final position = _scrollController.position;
+    _scrollController.jumpTo(
+      (index * _tileExtent).clamp(0.0, position.maxScrollExtent),
+    );
+  }
+
+  Widget _buildRangeIndex(BuildContext context) {
+    final count = _episodes.length;
+    return SingleChildScrollView(
+      scrollDirection: Axis.horizontal,
+      child: Row(
+        children: [
+          for (var start = 0; start < count; start += _rangeSize)
+            Padding(
+              padding: const EdgeInsets.only(right: 8),
+              child: ActionChip(
+                label: Text(
+                  '${_episodes[start].number}–'
+                  '${_episodes[min(start + _rangeSize, count) - 1].number}',
+                ),
+                onPressed: () => _jumpToEpisode(start),
+              ),
+            ),
+        ],
+      ),
+    );
+  }
+
   @override
   Widget build(BuildContext context) {
     return Scaffold(
@@ -70,14 +159,24 @@ class _DetailsScreenState extends State<DetailsScreen> {
                             color: Theme.of(context).colorScheme.onSurfaceVariant,
                           ),
                     ),
+                    if (_isRefreshing) ...[
+                      const SizedBox(height: 8),
+                      const LinearProgressIndicator(minHeight: 2),
+                    ],
+                    if (_episodes.length > _rangeSize) ...[
+                      const SizedBox(height: 12),
+                      _buildRangeIndex(context),
+                    ],
                     const SizedBox(height: 16),
                     Expanded(
-                      child: ListView.separated(
+                      child: ListView.builder(
+                        controller: _scrollController,
                         itemCount: _episodes.length,
-                        separatorBuilder: (context, index) => const SizedBox(height: 8),
+                        itemExtent: _tileExtent,
                         itemBuilder: (context, index) {
                           final ep = _episodes[index];
                           return Container(
+                            margin: const EdgeInsets.only(bottom: 8),
                             decoration: BoxDecoration(
                               color: Theme.of(context).colorScheme.surfaceContainer,
                               borderRadius: BorderRadius.circular(8),
@@ -1,7 +1,9 @@
 import 'package:flutter/material.dart';
-import 'package:jikan_api/jikan_api.dart';
+import 'package:anigen/models/anime_card.dart';
 import 'package:anigen/providers/jikan_provider.dart';
 import 'package:anigen/screens/anime_info_screen.dart';
+import 'package:anigen/services/catalog_index.dart';
+import 'package:anigen/widgets/anime_info_prefetch_trigger.dart';
 
 class GenreAnimeScreen extends StatefulWidget {
   final int genreId;
@@ -21,7 +23,7 @@ class GenreAnimeScreen extends StatefulWidget {
 
 class _GenreAnimeScreenState extends State<GenreAnimeScreen> {
   final JikanProvider _jikanProvider = JikanProvider();
-  List<Anime> _animeList = [];
+  List<AnimeCard> _animeList = [];
   bool _isLoading = true;
   String? _error;
 
@@ -39,8 +41,9 @@ class _GenreAnimeScreenState extends State<GenreAnimeScreen> {
 
     try {
       final anime = await _jikanProvider.getAnimeByGenre(widget.genreId);
+      CatalogIndex.instance.addJikanAnime(anime);
       setState(() {
-        _animeList = anime.take(50).toList();
+        _animeList = AnimeCard.fromJikanList(anime.take(50));
         _isLoading = false;
       });
     } catch (e) {
@@ -105,58 +108,59 @@ class _GenreAnimeScreenState extends State<GenreAnimeScreen> {
                           itemCount: _animeList.length,
                           itemBuilder: (context, index) {
                             final anime = _animeList[index];
-                        return GestureDetector(
-                          onTap: () {
-                            if (anime.malId != null) {
+                        return AnimeInfoPrefetchTrigger(
+                          malId: anime.malId,
+                          child: GestureDetector(
+                            onTap: () {
                               Navigator.push(
                                 context,
                                 MaterialPageRoute(
                                   builder: (context) => AnimeInfoScreen(
-                                    malId: anime.malId!,
-                                    animeTitle: anime.title ?? 'Unknown',
+                                    malId: anime.malId,
+                                    animeTitle: anime.title,
                                     onSearchPressed: widget.onSearchPressed,
                                   ),
                                 ),
                               );
-                            }
-                          },
-                          child: Column(
-                            crossAxisAlignment: CrossAxisAlignment.start,
-                            children: [
-                              ClipRRect(
-                                borderRadius: BorderRadius.circular(8),
-                                child: AspectRatio(
-                                  aspectRatio: 0.7,
-                                  child: anime.imageUrl != null
-                                      ? Image.network(
-                                          anime.imageUrl!,
-                                          width: double.infinity,
-                                          fit: BoxFit.cover,
-                                          errorBuilder: (context, error, stackTrace) => Container(
+                            },
+                            child: Column(
+                              crossAxisAlignment: CrossAxisAlignment.start,
+                              children: [
+                                ClipRRect(
+                                  borderRadius: BorderRadius.circular(8),
+                                  child: AspectRatio(
+                                    aspectRatio: 0.7,
+                                    child: anime.imageUrl != null
+                                        ? Image.network(
+                                            anime.imageUrl!,
+                                            width: double.infinity,
+                                            fit: BoxFit.cover,
+                                            errorBuilder: (context, error, stackTrace) => Container(
+                                              color: Theme.of(context).colorScheme.surfaceContainer,
+                                              child: const Icon(Icons.broken_image),
+                                            ),
+                                          )
+                                        : Container(
                                             color: Theme.of(context).colorScheme.surfaceContainer,
-                                            child: const Icon(Icons.broken_image),
+                                            child: const Icon(Icons.movie),
                                           ),
-                                        )
-                                      : Container(
-                                          color: Theme.of(context).colorScheme.surfaceContainer,
-                                          child: const Icon(Icons.movie),
-                                        ),
+                                  ),
                                 ),
-                              ),
-                              const SizedBox(height: 4),
-                              Text(
-                                anime.title ?? 'Unknown',
-                                maxLines: 2,
-                                overflow: TextOverflow.ellipsis,
-                                style: Theme.of(context).textTheme.bodySmall?.copyWith(
-                                      fontWeight: FontWeight.w500,
-                                      fontSize: isDesktop ? 12 : 11,
-                                      height: 1.2,
-                                    ),
-                              ),
-                            ],
+                                const SizedBox(height: 4),
+                                Text(
+                                  anime.title,
+                                  maxLines: 2,
+                                  overflow: TextOverflow.ellipsis,
+                                  style: Theme.of(context).textTheme.bodySmall?.copyWith(
+                                        fontWeight: FontWeight.w500,
+                                        fontSize: isDesktop ? 12 : 11,
+                                        height: 1.2,
+                                      ),
+                                ),
+                              ],
+                            ),
                           ),
-                            );
+                        );
                           },
                         );
                       },
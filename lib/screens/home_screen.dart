@@ -3,34 +3,94 @@ import 'package:anigen/screens/search_screen.dart';
 import 'package:anigen/screens/profile_screen.dart';
 import 'package:anigen/screens/anime_info_screen.dart';
 import 'package:anigen/screens/genre_anime_screen.dart';
+import 'package:anigen/models/anime_card.dart';
 import 'package:anigen/providers/jikan_provider.dart';
+import 'package:anigen/services/catalog_index.dart';
+import 'package:anigen/widgets/anime_info_prefetch_trigger.dart';
 import 'package:jikan_api/jikan_api.dart';
 
 class HomeScreen extends StatefulWidget {
-  const HomeScreen({super.key});
+  /// Drop hidden tabs when the OS reports memory pressure. They are rebuilt,
+  /// and refetch their data, the next time they are selected.
+  final bool evictHiddenTabsOnMemoryPressure;
+
+  const HomeScreen({super.key, this.evictHiddenTabsOnMemoryPressure = true});
 
   @override
   State<HomeScreen> createState() => _HomeScreenState();
 }
 
-class _HomeScreenState extends State<HomeScreen> {
+class _HomeScreenState extends State<HomeScreen> with WidgetsBindingObserver {
+  static const int _tabCount = 3;
+
   int _currentIndex = 0;
   final GlobalKey<SearchScreenState> _searchScreenKey = GlobalKey<SearchScreenState>();
-  
-  void _navigateToSearchWithQuery(String query) {
+  // Global keys let a tab keep its state when the layout switches between the
+  // navigation rail and the bottom bar.
+  final GlobalKey _homeContentKey = GlobalKey();
+  final GlobalKey _profileKey = GlobalKey();
+  // Tabs are built on first selection and then kept alive in the IndexedStack.
+  final List<Widget?> _tabs = List.filled(_tabCount, null);
+
+  @override
+  void initState() {
+    super.initState();
+    _tabs[_currentIndex] = _createTab(_currentIndex);
+    WidgetsBinding.instance.addObserver(this);
+  }
+
+  @override
+  void dispose() {
+    WidgetsBinding.instance.removeObserver(this);
+    super.dispose();
+  }
+
+  @override
+  void didHaveMemoryPressure() {
+    if (!widget.evictHiddenTabsOnMemoryPressure) return;
+    setState(() {
+      for (var i = 0; i < _tabCount; i++) {
+        if (i != _currentIndex) _tabs[i] = null;
+      }
+    });
+  }
+
+  Widget _createTab(int index) {
+    switch (index) {
+      case 0:
+        return HomeContentScreen(
+          key: _homeContentKey,
+          onNavigateToSearch: _navigateToSearchWithQuery,
+        );
+      case 1:
+        return SearchScreen(key: _searchScreenKey);
+      default:
+        return ProfileScreen(key: _profileKey);
+    }
+  }
+
+  void _selectTab(int index) {
     setState(() {
-      _currentIndex = 1;
+      _currentIndex = index;
+      _tabs[index] ??= _createTab(index);
     });
+  }
+
+  void _navigateToSearchWithQuery(String query) {
+    _selectTab(1);
     // Use addPostFrameCallback to ensure navigation completes before setting text
     WidgetsBinding.instance.addPostFrameCallback((_) {
       _searchScreenKey.currentState?.setSearchQuery(query);
     });
   }
-  
+
   List<Widget> get _screens => [
-    HomeContentScreen(onNavigateToSearch: _navigateToSearchWithQuery),
-    SearchScreen(key: _searchScreenKey),
-    const ProfileScreen(),
+    for (var i = 0; i < _tabCount; i++)
+      if (_tabs[i] == null)
+        const SizedBox.shrink()
+      else
+        // Hidden tabs keep their state but stop animating.
+        TickerMode(enabled: i == _currentIndex, child: _tabs[i]!),
   ];
 
   @override
@@ -45,11 +105,7 @@ class _HomeScreenState extends State<HomeScreen> {
               children: [
                 NavigationRail(
                   selectedIndex: _currentIndex,
-                  onDestinationSelected: (index) {
-                    setState(() {
-                      _currentIndex = index;
-                    });
-                  },
+                  onDestinationSelected: _selectTab,
                   labelType: NavigationRailLabelType.all,
                   minWidth: 76,
                   minExtendedWidth: 180,
@@ -126,11 +182,7 @@ class _HomeScreenState extends State<HomeScreen> {
                             ? Theme.of(context).colorScheme.primary
                             : Theme.of(context).colorScheme.onSurfaceVariant,
                       ),
-                      onPressed: () {
-                        setState(() {
-                          _currentIndex = 0;
-                        });
-                      },
+                      onPressed: () => _selectTab(0),
                     ),
                     IconButton(
                       icon: Icon(
@@ -139,11 +191,7 @@ class _HomeScreenState extends State<HomeScreen> {
                             ? Theme.of(context).colorScheme.primary
                             : Theme.of(context).colorScheme.onSurfaceVariant,
                       ),
-                      onPressed: () {
-                        setState(() {
-                          _currentIndex = 1;
-                        });
-                      },
+                      onPressed: () => _selectTab(1),
                     ),
                     IconButton(
                       icon: Icon(
@@ -152,11 +200,7 @@ class _HomeScreenState extends State<HomeScreen> {
                             ? Theme.of(context).colorScheme.primary
                             : Theme.of(context).colorScheme.onSurfaceVariant,
                       ),
-                      onPressed: () {
-                        setState(() {
-                          _currentIndex = 2;
-                        });
-                      },
+                      onPressed: () => _selectTab(2),
                     ),
                   ],
                 ),
@@ -180,11 +224,11 @@ class HomeContentScreen extends StatefulWidget {
 
 class _HomeContentScreenState extends State<HomeContentScreen> {
   final JikanProvider _jikanProvider = JikanProvider();
-  List<Anime> _topAnime = [];
-  List<Anime> _currentSeason = [];
-  List<Anime> _popularAnime = [];
-  List<Anime> _upcomingAnime = [];
-  List<Anime> _airingToday = [];
+  List<AnimeCard> _topAnime = [];
+  List<AnimeCard> _currentSeason = [];
+  List<AnimeCard> _popularAnime = [];
+  List<AnimeCard> _upcomingAnime = [];
+  List<AnimeCard> _airingToday = [];
   List<Genre> _genres = [];
   bool _isLoading = true;
   String? _error;
@@ -204,22 +248,30 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
     });
 
     try {
-      final results = await Future.wait([
+      final (top, season, popular, upcoming, airing, genres) = await (
         _jikanProvider.getTopAnime(),
         _jikanProvider.getSeasonAnime(),
         _jikanProvider.getPopularAnime(),
         _jikanProvider.getUpcomingAnime(),
         _jikanProvider.getAiringToday(),
         _jikanProvider.getAnimeGenres(),
-      ]);
+      ).wait;
 
+      // The index wants alternate titles, so feed it before projecting.
+      CatalogIndex.instance.addJikanAnime([
+        ...top,
+        ...season,
+        ...popular,
+        ...upcoming,
+        ...airing,
+      ]);
       setState(() {
-        _topAnime = results[0] as List<Anime>;
-        _currentSeason = results[1] as List<Anime>;
-        _popularAnime = results[2] as List<Anime>;
-        _upcomingAnime = results[3] as List<Anime>;
-        _airingToday = results[4] as List<Anime>;
-        _genres = results[5] as List<Genre>;
+        _topAnime = AnimeCard.fromJikanList(top);
+        _currentSeason = AnimeCard.fromJikanList(season);
+        _popularAnime = AnimeCard.fromJikanList(popular);
+        _upcomingAnime = AnimeCard.fromJikanList(upcoming);
+        _airingToday = AnimeCard.fromJikanList(airing);
+        _genres = genres;
         _isLoading = false;
       });
     } catch (e) {
@@ -285,6 +337,7 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
               : RefreshIndicator(
                   onRefresh: _loadData,
                   child: ListView(
+                    key: const PageStorageKey('home_feed'),
                     padding: const EdgeInsets.symmetric(vertical: 16),
                     children: [
                       // Pill-shaped switcher
@@ -321,6 +374,7 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
                         SizedBox(
                           height: cardHeight + 40,
                           child: ListView.builder(
+                            key: const PageStorageKey('top_anime'),
                             scrollDirection: Axis.horizontal,
                             padding: EdgeInsets.symmetric(horizontal: horizontalPadding),
                             itemCount: _topAnime.length > 10 ? 10 : _topAnime.length,
@@ -335,6 +389,7 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
                         SizedBox(
                           height: cardHeight + 40,
                           child: ListView.builder(
+                            key: const PageStorageKey('popular_anime'),
                             scrollDirection: Axis.horizontal,
                             padding: EdgeInsets.symmetric(horizontal: horizontalPadding),
                             itemCount: _popularAnime.length > 10 ? 10 : _popularAnime.length,
@@ -381,6 +436,7 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
                         SizedBox(
                           height: cardHeight + 40,
                           child: ListView.builder(
+                            key: const PageStorageKey('current_season'),
                             scrollDirection: Axis.horizontal,
                             padding: EdgeInsets.symmetric(horizontal: horizontalPadding),
                             itemCount: _currentSeason.length > 10 ? 10 : _currentSeason.length,
@@ -394,6 +450,7 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
                         SizedBox(
                           height: cardHeight + 40,
                           child: ListView.builder(
+                            key: const PageStorageKey('upcoming_anime'),
                             scrollDirection: Axis.horizontal,
                             padding: EdgeInsets.symmetric(horizontal: horizontalPadding),
                             itemCount: _upcomingAnime.length > 10 ? 10 : _upcomingAnime.length,
@@ -492,60 +549,61 @@ class _HomeContentScreenState extends State<HomeContentScreen> {
     );
   }
 
-  Widget _buildAnimeCard(Anime anime, BuildContext context, double cardWidth, double imageHeight) {
-    return GestureDetector(
-      onTap: () {
-        if (anime.malId != null) {
+  Widget _buildAnimeCard(AnimeCard anime, BuildContext context, double cardWidth, double imageHeight) {
+    return AnimeInfoPrefetchTrigger(
+      malId: anime.malId,
+      child: GestureDetector(
+        onTap: () {
           Navigator.push(
             context,
             MaterialPageRoute(
               builder: (context) => AnimeInfoScreen(
-                malId: anime.malId!,
-                animeTitle: anime.title ?? 'Unknown',
+                malId: anime.malId,
+                animeTitle: anime.title,
                 onSearchPressed: widget.onNavigateToSearch,
               ),
             ),
           );
-        }
-      },
-      child: Container(
-        width: cardWidth,
-        margin: const EdgeInsets.only(right: 12),
-        child: Column(
-          crossAxisAlignment: CrossAxisAlignment.start,
-          children: [
-            ClipRRect(
-              borderRadius: BorderRadius.circular(8),
-              child: anime.imageUrl != null
-                  ? Image.network(
-                      anime.imageUrl!,
-                      height: imageHeight,
-                      width: cardWidth,
-                      fit: BoxFit.cover,
-                      errorBuilder: (context, error, stackTrace) => Container(
+        },
+        child: Container(
+          width: cardWidth,
+          margin: const EdgeInsets.only(right: 12),
+          child: Column(
+            crossAxisAlignment: CrossAxisAlignment.start,
+            children: [
+              ClipRRect(
+                borderRadius: BorderRadius.circular(8),
+                child: anime.imageUrl != null
+                    ? Image.network(
+                        anime.imageUrl!,
+                        height: imageHeight,
+                        width: cardWidth,
+                        fit: BoxFit.cover,
+                        errorBuilder: (context, error, stackTrace) => Container(
+                          height: imageHeight,
+                          width: cardWidth,
+                          color: Theme.of(context).colorScheme.surfaceContainer,
+                          child: const Icon(Icons.broken_image),
+                        ),
+                      )
+                    : Container(
                         height: imageHeight,
                         width: cardWidth,
                         color: Theme.of(context).colorScheme.surfaceContainer,
-                        child: const Icon(Icons.broken_image),
+                        child: const Icon(Icons.movie),
                       ),
-                    )
-                  : Container(
-                      height: imageHeight,
-                      width: cardWidth,
-                      color: Theme.of(context).colorScheme.surfaceContainer,
-                      child: const Icon(Icons.movie),
+              ),
+              const SizedBox(height: 8),
+              Text(
+                anime.title,
+                maxLines: 2,
+                overflow: TextOverflow.ellipsis,
+                style: Theme.of(context).textTheme.bodySmall?.copyWith(
+                      fontWeight: FontWeight.w500,
                     ),
-            ),
-            const SizedBox(height: 8),
-            Text(
-              anime.title ?? 'Unknown',
-              maxLines: 2,
-              overflow: TextOverflow.ellipsis,
-              style: Theme.of(context).textTheme.bodySmall?.copyWith(
-                    fontWeight: FontWeight.w500,
-                  ),
-            ),
-          ],
+              ),
+            ],
+          ),
         ),
       ),
     );
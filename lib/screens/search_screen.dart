@@ -2,6 +2,8 @@ import 'package:flutter/material.dart';
 import 'package:anigen/models/anime.dart';
 import 'package:anigen/providers/anime_provider.dart';
 import 'package:anigen/screens/details_screen.dart';
+import 'package:anigen/services/catalog_index.dart';
+import 'package:anigen/services/episode_watcher.dart';
 import 'package:shared_preferences/shared_preferences.dart';
 import 'dart:async';
 import 'dart:convert';
@@ -22,6 +24,9 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
   bool _hasSearched = false;
   late AnimationController _animationController;
   Timer? _debounce;
+  // Bumped for every search and whenever the query becomes too short, so only
+  // the latest search may touch the results or the spinner.
+  int _searchGeneration = 0;
 
   @override
   void initState() {
@@ -51,19 +56,53 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
     final query = _searchController.text;
     
     if (query.isEmpty) {
+      _debounce?.cancel();
+      _searchGeneration++;
       setState(() {
         _hasSearched = false;
+        _isLoading = false;
         _results = [];
       });
       return;
     }
 
-    if (query.length >= 2) {
-      if (_debounce?.isActive ?? false) _debounce!.cancel();
-      _debounce = Timer(const Duration(milliseconds: 400), () {
-        _search(query: query);
-      });
+    if (query.length < 2) {
+      // Too short to search; drop any pending or running one.
+      _debounce?.cancel();
+      _searchGeneration++;
+      if (_isLoading) {
+        setState(() {
+          _isLoading = false;
+        });
+      }
+      return;
     }
+
+    _showLocalMatches(query);
+    if (_debounce?.isActive ?? false) _debounce!.cancel();
+    _debounce = Timer(const Duration(milliseconds: 400), () {
+      _search(query: query);
+    });
+  }
+
+  // Instant results from titles seen before; network results are merged in
+  // once the debounced search answers.
+  void _showLocalMatches(String query) {
+    final local = _localMatches(query);
+    if (local.isEmpty) return;
+    setState(() {
+      _hasSearched = true;
+      _results = local;
+    });
+    _animationController.value = 1;
+  }
+
+  List<Anime> _localMatches(String query) {
+    return CatalogIndex.instance
+        .search(query)
+        .where((match) => match.entry.isPlayable)
+        .map((match) => match.entry.toAnime())
+        .toList();
   }
 
   Future<void> _loadRecentAnime() async {
@@ -127,6 +166,7 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
   void _search({String? query}) async {
     final searchQuery = query ?? _searchController.text;
     if (searchQuery.isEmpty) return;
+    final generation = ++_searchGeneration;
 
     setState(() {
       _isLoading = true;
@@ -134,21 +174,44 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
     });
 
     try {
-      final results = await _provider.search(searchQuery);
+      var results = await _provider.search(searchQuery);
+      if (results.isEmpty) {
+        // Retry with the title the local index knows for this query, e.g. the
+        // romaji name when an English title was typed
+        final best = CatalogIndex.instance.bestMatch(searchQuery);
+        if (best != null &&
+            CatalogIndex.normalize(best.entry.title) !=
+                CatalogIndex.normalize(searchQuery)) {
+          results = await _provider.search(best.entry.title);
+        }
+      }
+      CatalogIndex.instance.addAllAnime(results);
+
+      // A newer query has taken over
+      if (!mounted || generation != _searchGeneration) return;
+
+      final seen = results.map((a) => a.url).toSet();
+      final merged = [
+        ...results,
+        ..._localMatches(searchQuery).where((a) => seen.add(a.url)),
+      ];
+      final animate = _results.isEmpty;
       setState(() {
-        _results = results;
+        _results = merged;
       });
-      _animationController.forward(from: 0);
+      if (animate) _animationController.forward(from: 0);
     } catch (e) {
-      if (mounted) {
+      if (mounted && generation == _searchGeneration) {
         ScaffoldMessenger.of(context).showSnackBar(
           SnackBar(content: Text('error: $e')),
         );
       }
     } finally {
-      setState(() {
-        _isLoading = false;
-      });
+      if (mounted && generation == _searchGeneration) {
+        setState(() {
+          _isLoading = false;
+        });
+      }
     }
   }
 
@@ -209,6 +272,7 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
                       SizedBox(
                         height: 180,
                         child: ListView.separated(
+                          key: const PageStorageKey('recent_anime'),
                           scrollDirection: Axis.horizontal,
                           itemCount: _recentAnime.length,
                           separatorBuilder: (context, index) => const SizedBox(width: 12),
@@ -228,27 +292,57 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
                                 child: Column(
                                   crossAxisAlignment: CrossAxisAlignment.start,
                                   children: [
-                                    ClipRRect(
-                                      borderRadius: BorderRadius.circular(8),
-                                      child: anime.thumbnail != null
-                                          ? Image.network(
-                                              anime.thumbnail!,
-                                              width: 120,
-                                              height: 140,
-                                              fit: BoxFit.cover,
-                                              errorBuilder: (context, error, stackTrace) => Container(
-                                                width: 120,
-                                                height: 140,
-                                                color: Theme.of(context).colorScheme.surfaceContainer,
-                                                child: const Icon(Icons.broken_image),
+                                    Stack(
+                                      children: [
+                                        ClipRRect(
+                                          borderRadius: BorderRadius.circular(8),
+                                          child: anime.thumbnail != null
+                                              ? Image.network(
+                                                  anime.thumbnail!,
+                                                  width: 120,
+                                                  height: 140,
+                                                  fit: BoxFit.cover,
+                                                  errorBuilder: (context, error, stackTrace) => Container(
+                                                    width: 120,
+                                                    height: 140,
+                                                    color: Theme.of(context).colorScheme.surfaceContainer,
+                                                    child: const Icon(Icons.broken_image),
+                                                  ),
+                                                )
+                                              : Container(
+                                                  width: 120,
+                                                  height: 140,
+                                                  color: Theme.of(context).colorScheme.surfaceContainer,
+                                                  child: const Icon(Icons.movie_outlined),
+                                                ),
+                                        ),
+                                        ValueListenableBuilder<Set<String>>(
+                                          valueListenable: EpisodeWatcher.instance.newEpisodes,
+                                          builder: (context, newEpisodes, child) {
+                                            if (!newEpisodes.contains(anime.url)) {
+                                              return const SizedBox.shrink();
+                                            }
+                                            return Positioned(
+                                              top: 6,
+                                              right: 6,
+                                              child: Container(
+                                                padding: const EdgeInsets.symmetric(horizontal: 6, vertical: 2),
+                                                decoration: BoxDecoration(
+                                                  color: Theme.of(context).colorScheme.primary,
+                                                  borderRadius: BorderRadius.circular(8),
+                                                ),
+                                                child: Text(
+                                                  'new',
+                                                  style: Theme.of(context).textTheme.labelSmall?.copyWith(
+                                                        color: Theme.of(context).colorScheme.onPrimary,
+                                                        fontWeight: FontWeight.w600,
+                                                      ),
+                                                ),
                                               ),
-                                            )
-                                          : Container(
-                                              width: 120,
-                                              height: 140,
-                                              color: Theme.of(context).colorScheme.surfaceContainer,
-                                              child: const Icon(Icons.movie_outlined),
-                                            ),
+                                            );
+                                          },
+                                        ),
+                                      ],
                                     ),
                                     const SizedBox(height: 8),
                                     Text(
@@ -270,8 +364,12 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
               
               const SizedBox(height: 16),
               
+              // Local matches are showing while the network search runs
+              if (_isLoading && _results.isNotEmpty)
+                const LinearProgressIndicator(minHeight: 2),
+              
               Expanded(
-                child: _isLoading
+                child: _isLoading && _results.isEmpty
                     ? const Center(child: CircularProgressIndicator())
                     : !_hasSearched
                         ? _recentAnime.isNotEmpty
@@ -334,6 +432,7 @@ class SearchScreenState extends State<SearchScreen> with SingleTickerProviderSta
                                 child: FadeTransition(
                                   opacity: _animationController,
                                   child: ListView.separated(
+                                    key: const PageStorageKey('search_results'),
                                     physics: const AlwaysScrollableScrollPhysics(),
                                     itemCount: _results.length,
                                     separatorBuilder: (context, index) => const SizedBox(height: 8),
@@ -0,0 +1,154 @@
+import 'dart:async';
+import 'dart:collection';
+import 'package:flutter/widgets.dart';
+import 'package:jikan_api/jikan_api.dart';
+import '../providers/jikan_provider.dart';
+
+/// Low-priority lane that loads `AnimeInfoScreen` data for titles the user is
+/// looking at, so the screen can open without a spinner.
+///
+/// Requests run one at a time, only while no foreground Jikan request is in
+/// flight, and at most [budgetPerMinute] per minute so the lane stays well
+/// inside Jikan's rate limit.
+class AnimeInfoPrefetcher {
+  static final AnimeInfoPrefetcher instance = AnimeInfoPrefetcher();
+
+  final JikanProvider _provider;
+  final int budgetPerMinute;
+  final int cacheSize;
+
+  /// Also warm the image cache with each prefetched title's poster.
+  final bool precacheImages;
+
+  // Insertion order doubles as LRU order.
+  final LinkedHashMap<int, Anime> _cache = LinkedHashMap();
+  final Map<int, Future<Anime>> _pending = {};
+  // Most recent request last; it is the most likely next tap.
+  final List<int> _queue = [];
+  final Queue<DateTime> _spent = Queue();
+  bool _draining = false;
+  bool _disposed = false;
+  Timer? _waitTimer;
+  Completer<void>? _waiting;
+
+  AnimeInfoPrefetcher({
+    JikanProvider? provider,
+    this.budgetPerMinute = 20,
+    this.cacheSize = 100,
+    this.precacheImages = true,
+  }) : _provider = provider ?? JikanProvider();
+
+  Anime? cached(int malId) {
+    final anime = _cache.remove(malId);
+    if (anime != null) _cache[malId] = anime;
+    return anime;
+  }
+
+  /// Loads [malId] for display, reusing a cached or in-flight prefetch.
+  Future<Anime> load(int malId) async {
+    final hit = cached(malId);
+    if (hit != null) return hit;
+    _queue.remove(malId);
+    final pending = _pending[malId];
+    if (pending != null) return pending;
+
+    final anime = await _provider.getAnime(malId);
+    _store(malId, anime);
+    return anime;
+  }
+
+  /// Queues [malId] for background loading if it is not known yet.
+  void prefetch(int malId) {
+    if (_disposed) return;
+    if (_cache.containsKey(malId) || _pending.containsKey(malId)) return;
+    _queue
+      ..remove(malId)
+      ..add(malId);
+    _drain();
+  }
+
+  Future<void> _drain() async {
+    if (_draining) return;
+    _draining = true;
+    try {
+      while (_queue.isNotEmpty && !_disposed) {
+        if (JikanProvider.inFlight > 0) {
+          await _wait(const Duration(milliseconds: 300));
+          continue;
+        }
+
+        final now = DateTime.now();
+        while (_spent.isNotEmpty &&
+            now.difference(_spent.first) >= const Duration(minutes: 1)) {
+          _spent.removeFirst();
+        }
+        if (_spent.length >= budgetPerMinute) {
+          await _wait(
+            const Duration(minutes: 1) - now.difference(_spent.first),
+          );
+          continue;
+        }
+
+        final malId = _queue.removeLast();
+        _spent.addLast(now);
+        final request = _provider.getAnime(malId, background: true);
+        _pending[malId] = request;
+        try {
+          final anime = await request;
+          _store(malId, anime);
+          if (precacheImages) _precacheImage(anime.imageUrl);
+        } catch (e) {
+          // Leave it to the foreground load
+        } finally {
+          _pending.remove(malId);
+        }
+      }
+    } finally {
+      _draining = false;
+    }
+  }
+
+  /// Drops queued prefetches and ends any wait for budget, so no timer
+  /// outlives the prefetcher.
+  void dispose() {
+    _disposed = true;
+    _queue.clear();
+    _waitTimer?.cancel();
+    final waiting = _waiting;
+    if (waiting != null && !waiting.isCompleted) waiting.complete();
+    _waiting = null;
+  }
+
+  // A delay that [dispose] can cut short.
+  Future<void> _wait(Duration duration) {
+    final waiting = Completer<void>();
+    _waiting = waiting;
+    _waitTimer = Timer(duration, () {
+      if (!waiting.isCompleted) waiting.complete();
+    });
+    return waiting.future.whenComplete(() {
+      if (identical(_waiting, waiting)) _waiting = null;
+    });
+  }
+
+  void _store(int malId, Anime anime) {
+    _cache.remove(malId);
+    _cache[malId] = anime;
+    while (_cache.length > cacheSize) {
+      _cache.remove(_cache.keys.first);
+    }
+  }
+
+  // Resolving the provider puts the decoded image in the global ImageCache,
+  // where the info screen's Image.network finds it under the same key.
+  void _precacheImage(String? url) {
+    if (url == null) return;
+    final stream = NetworkImage(url).resolve(ImageConfiguration.empty);
+    late final ImageStreamListener listener;
+    listener = ImageStreamListener(
+      (image, synchronousCall) => stream.removeListener(listener),
+      onError: (error, stackTrace) => stream.removeListener(listener),
+    );
+    stream.addListener(listener);
+  }
+}
@@ -0,0 +1,378 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+import 'dart:isolate';
+import 'dart:math';
+import 'dart:typed_data';
+import 'package:jikan_api/jikan_api.dart' as jikan;
+import 'package:path_provider/path_provider.dart';
+import '../models/anime.dart';
+
+/// A title the app has seen in search results, home feeds or genre pages.
+class CatalogEntry {
+  final String title;
+  final List<String> altTitles;
+
+  /// AllAnime show ID; entries without one are only known from Jikan and
+  /// cannot be played directly.
+  final String? allAnimeId;
+  final int? malId;
+  final String? thumbnail;
+
+  const CatalogEntry({
+    required this.title,
+    this.altTitles = const [],
+    this.allAnimeId,
+    this.malId,
+    this.thumbnail,
+  });
+
+  bool get isPlayable => allAnimeId != null;
+
+  Anime toAnime() => Anime(title: title, url: allAnimeId!, thumbnail: thumbnail);
+
+  List<dynamic> toJson() => [title, altTitles, allAnimeId, malId, thumbnail];
+
+  factory CatalogEntry.fromJson(List<dynamic> json) => CatalogEntry(
+        title: json[0] as String,
+        altTitles: List<String>.from(json[1] as List),
+        allAnimeId: json[2] as String?,
+        malId: json[3] as int?,
+        thumbnail: json[4] as String?,
+      );
+}
+
+class CatalogMatch {
+  final CatalogEntry entry;
+  final double score;
+
+  const CatalogMatch(this.entry, this.score);
+}
+
+/// Local, incrementally built title index for instant search.
+///
+/// Every title and alternate title is normalized (case, diacritics, romaji
+/// long vowels) and split into trigrams. Queries are scored by trigram
+/// overlap, which tolerates typos and partial words, so results can be shown
+/// on every keystroke before the network answers.
+class CatalogIndex {
+  static final CatalogIndex instance = CatalogIndex();
+
+  static const String _fileName = 'catalog_index.json';
+
+  /// Score [bestMatch] requires; see [search] for how scores are made.
+  static const double minConfidentScore = 0.5;
+
+  /// Where the index is saved; defaults to the app support directory.
+  final String? path;
+
+  List<CatalogEntry> _entries = [];
+  // Entry lookup by AllAnime ID, MAL ID and normalized title.
+  Map<String, int> _byKey = {};
+
+  // One "name" per indexed title string; several names map to one entry.
+  List<int> _nameEntry = [];
+  List<String> _nameText = [];
+  List<int> _nameGrams = [];
+  Map<int, List<int>> _postings = {};
+
+  Uint16List _scratch = Uint16List(0);
+  Timer? _saveTimer;
+  // Left null until used, so an index built on another isolate can be sent
+  // back to this one.
+  Future<void>? _loading;
+  Future<void>? _saving;
+
+  CatalogIndex({this.path});
+
+  int get length => _entries.length;
+
+  /// Restores the index saved by a previous session.
+  ///
+  /// Only entries are stored, and the trigram postings are rebuilt from them
+  /// on a background isolate. That keeps the file small and lets the scoring
+  /// change without a migration. Storing the postings too would skip the
+  /// rebuild, but the rebuild never blocks the UI isolate; it only delays
+  /// local results after a cold start. The benchmark reports that delay at
+  /// 50k titles as `catalog.load`. Titles added before the saved index
+  /// arrives are merged into it.
+  Future<void> load() => _loading ??= _load();
+
+  Future<void> _load() async {
+    try {
+      final file = await _file();
+      if (!await file.exists()) return;
+      _adopt(await _readInBackground(file.path));
+    } catch (e) {
+      // Start from an empty index
+    }
+  }
+
+  void _adopt(CatalogIndex loaded) {
+    final added = _entries;
+    _entries = loaded._entries;
+    _byKey = loaded._byKey;
+    _nameEntry = loaded._nameEntry;
+    _nameText = loaded._nameText;
+    _nameGrams = loaded._nameGrams;
+    _postings = loaded._postings;
+    for (final entry in added) {
+      add(entry, persist: false);
+    }
+  }
+
+  // Static, so the closures capture only what they are given.
+  static Future<CatalogIndex> _readInBackground(String path) {
+    return Isolate.run(() {
+      final index = CatalogIndex();
+      final json = jsonDecode(File(path).readAsStringSync()) as List<dynamic>;
+      for (final item in json) {
+        index.add(CatalogEntry.fromJson(item as List<dynamic>), persist: false);
+      }
+      return index;
+    });
+  }
+
+  static Future<void> _writeInBackground(
+    String path,
+    List<CatalogEntry> entries,
+  ) {
+    return Isolate.run(() {
+      // Written aside and renamed, so a crash never leaves half a file.
+      File('$path.tmp')
+        ..writeAsStringSync(jsonEncode(entries))
+        ..renameSync(path);
+    });
+  }
+
+  void addAllAnime(Iterable<Anime> anime) {
+    for (final a in anime) {
+      add(
+        CatalogEntry(title: a.title, allAnimeId: a.url, thumbnail: a.thumbnail),
+        persist: false,
+      );
+    }
+    _scheduleSave();
+  }
+
+  void addJikanAnime(Iterable<jikan.Anime> anime) {
+    for (final a in anime) {
+      final title = a.title;
+      if (title == null) continue;
+      add(
+        CatalogEntry(
+          title: title,
+          altTitles: [
+            if (a.titleEnglish != null) a.titleEnglish!,
+            ...?a.titleSynonyms,
+          ],
+          malId: a.malId,
+          thumbnail: a.imageUrl,
+        ),
+        persist: false,
+      );
+    }
+    _scheduleSave();
+  }
+
+  /// Inserts [entry], merging it into an existing entry for the same show.
+  void add(CatalogEntry entry, {bool persist = true}) {
+    final keys = _keysFor(entry);
+    final existing = keys.map((k) => _byKey[k]).whereType<int>().firstOrNull;
+
+    if (existing == null) {
+      final id = _entries.length;
+      _entries.add(entry);
+      _indexNames(id, [entry.title, ...entry.altTitles]);
+      for (final k in keys) {
+        _byKey[k] = id;
+      }
+    } else {
+      final old = _entries[existing];
+      final knownNames = {
+        normalize(old.title),
+        ...old.altTitles.map(normalize),
+      };
+      final newNames = [entry.title, ...entry.altTitles]
+          .where((t) => t.isNotEmpty && knownNames.add(normalize(t)))
+          .toList();
+      // Prefer the AllAnime name as the display title, since it is the one
+      // network search understands.
+      final adopt = old.allAnimeId == null && entry.allAnimeId != null;
+      final title = adopt ? entry.title : old.title;
+      _entries[existing] = CatalogEntry(
+        title: title,
+        altTitles: [
+          if (adopt) old.title,
+          ...old.altTitles,
+          ...newNames,
+        ].where((t) => t != title).toList(),
+        allAnimeId: old.allAnimeId ?? entry.allAnimeId,
+        malId: old.malId ?? entry.malId,
+        thumbnail: old.thumbnail ?? entry.thumbnail,
+      );
+      _indexNames(existing, newNames);
+      for (final k in _keysFor(_entries[existing])) {
+        _byKey[k] = existing;
+      }
+    }
+    if (persist) _scheduleSave();
+  }
+
+  /// The top match for [query] when it is close enough to stand in for it,
+  /// e.g. to retry a network search under that title: half its trigrams
+  /// shared, or the query found inside the title. Weaker matches only share
+  /// a few common grams with the query.
+  CatalogMatch? bestMatch(String query) {
+    final matches = search(query, limit: 1);
+    if (matches.isEmpty || matches.first.score < minConfidentScore) return null;
+    return matches.first;
+  }
+
+  /// Ranked fuzzy matches for [query], best first.
+  List<CatalogMatch> search(String query, {int limit = 20}) {
+    final normalized = normalize(query);
+    if (normalized.isEmpty || _nameText.isEmpty) return const [];
+    // The last word is usually still being typed, so no end-of-word gram.
+    final grams = trigrams(normalized, padEnd: false);
+    if (grams.isEmpty) return const [];
+
+    if (_scratch.length < _nameText.length) {
+      _scratch = Uint16List(_nameText.length + 1024);
+    }
+    final counts = _scratch;
+    final touched = <int>[];
+    var maxShared = 0;
+    for (final gram in grams) {
+      final posting = _postings[gram];
+      if (posting == null) continue;
+      for (final name in posting) {
+        final shared = ++counts[name];
+        if (shared == 1) touched.add(name);
+        if (shared > maxShared) maxShared = shared;
+      }
+    }
+
+    // Require a third of the query, and most of what the best name shares,
+    // so common grams do not drag thousands of weak candidates into scoring.
+    final threshold = max((grams.length / 3).ceil(), (maxShared * 0.6).ceil());
+    final top = <CatalogMatch>[];
+    final topEntries = <int>[];
+    for (final name in touched) {
+      final shared = counts[name];
+      counts[name] = 0;
+      if (shared < threshold) continue;
+
+      var score = 2 * shared / (grams.length + _nameGrams[name]);
+      final text = _nameText[name];
+      if (text.startsWith(normalized)) {
+        score += 0.5;
+      } else if (text.contains(normalized)) {
+        score += 0.25;
+      }
+      if (top.length == limit && score <= top.last.score) continue;
+
+      final entry = _nameEntry[name];
+      final existing = topEntries.indexOf(entry);
+      if (existing != -1) {
+        if (score <= top[existing].score) continue;
+        top.removeAt(existing);
+        topEntries.removeAt(existing);
+      } else if (top.length == limit) {
+        top.removeLast();
+        topEntries.removeLast();
+      }
+      var at = top.length;
+      while (at > 0 && top[at - 1].score < score) {
+        at--;
+      }
+      top.insert(at, CatalogMatch(_entries[entry], score));
+      topEntries.insert(at, entry);
+    }
+    return top;
+  }
+
+  void _indexNames(int entryId, Iterable<String> names) {
+    for (final raw in names) {
+      final text = normalize(raw);
+      if (text.isEmpty) continue;
+      final grams = trigrams(text);
+      final nameId = _nameText.length;
+      _nameEntry.add(entryId);
+      _nameText.add(text);
+      _nameGrams.add(grams.length);
+      for (final gram in grams) {
+        (_postings[gram] ??= []).add(nameId);
+      }
+    }
+  }
+
+  List<String> _keysFor(CatalogEntry entry) => [
+        if (entry.allAnimeId != null) 'a:${entry.allAnimeId}',
+        if (entry.malId != null) 'm:${entry.malId}',
+        't:${normalize(entry.title)}',
+      ];
+
+  void _scheduleSave() {
+    _saveTimer?.cancel();
+    _saveTimer = Timer(const Duration(seconds: 2), _save);
+  }
+
+  Future<void> _save() {
+    // One write at a time, each with the entries as of when it starts.
+    return _saving = (_saving ?? Future.value()).then((_) async {
+      try {
+        // Saving before the previous session's index is merged in would
+        // replace it with whatever this session has seen so far.
+        await load();
+        final file = await _file();
+        await _writeInBackground(file.path, List.of(_entries));
+      } catch (e) {
+        // Silently fail
+      }
+    });
+  }
+
+  Future<File> _file() async {
+    if (path != null) return File(path!);
+    final dir = await getApplicationSupportDirectory();
+    return File('${dir.path}/$_fileName');
+  }
+
+  static const Map<String, String> _folds = {
+    'à': 'a', 'á': 'a', 'â': 'a', 'ä': 'a', 'ã': 'a', 'å': 'a', 'ā': 'a',
+    'è': 'e', 'é': 'e', 'ê': 'e', 'ë': 'e', 'ē': 'e',
+    'ì': 'i', 'í': 'i', 'î': 'i', 'ï': 'i', 'ī': 'i',
+    'ò': 'o', 'ó': 'o', 'ô': 'o', 'ö': 'o', 'õ': 'o', 'ø': 'o', 'ō': 'o',
+    'ù': 'u', 'ú': 'u', 'û': 'u', 'ü': 'u', 'ū': 'u',
+    'ñ': 'n', 'ç': 'c', 'ß': 'ss',
+  };
+  static final RegExp _separators = RegExp(r'[^a-z0-9぀-ヿ一-鿿]+');
+  static final RegExp _longVowels = RegExp(r'ou|oo|uu|aa|ii|ee');
+
+  /// Lowercases, folds diacritics and romaji long vowels ("kyoujin" and
+  /// "kyōjin" both become "kyojin"), and collapses punctuation to spaces.
+  static String normalize(String input) {
+    final buffer = StringBuffer();
+    for (final rune in input.toLowerCase().runes) {
+      final char = String.fromCharCode(rune);
+      buffer.write(_folds[char] ?? char);
+    }
+    return buffer
+        .toString()
+        .replaceAll(_separators, ' ')
+        .replaceAllMapped(_longVowels, (m) => m[0]![0])
+        .trim();
+  }
+
+  /// Distinct trigrams of [normalized], padded so word starts and ends count.
+  static Set<int> trigrams(String normalized, {bool padEnd = true}) {
+    final padded = padEnd ? ' $normalized ' : ' $normalized';
+    final units = padded.codeUnits;
+    final grams = <int>{};
+    for (var i = 0; i + 2 < units.length; i++) {
+      grams.add((units[i] << 32) | (units[i + 1] << 16) | units[i + 2]);
+    }
+    return grams;
+  }
+}
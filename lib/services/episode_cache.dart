@@ -0,0 +1,74 @@
+import 'dart:convert';
+import 'dart:io';
+import 'package:path_provider/path_provider.dart';
+import '../models/anime.dart';
+
+/// Episode lists persisted per show, so `DetailsScreen` can render the last
+/// known list straight from disk while a refresh runs in the background.
+class EpisodeCache {
+  static final EpisodeCache instance = EpisodeCache();
+
+  static const String _dirName = 'episodes';
+
+  final Map<String, List<Episode>> _memory = {};
+  final Map<String, DateTime> _fetchedAt = {};
+  Directory? _dir;
+
+  /// Lists held in memory this session; no disk access.
+  List<Episode>? peek(String animeId) => _memory[animeId];
+
+  /// When [animeId]'s list was last fetched from the network this session.
+  DateTime? fetchedAt(String animeId) => _fetchedAt[animeId];
+
+  /// The cached list for [animeId], read from disk if not in memory yet.
+  Future<List<Episode>?> read(String animeId) async {
+    final hit = _memory[animeId];
+    if (hit != null) return hit;
+    try {
+      final file = await _file(animeId);
+      if (!await file.exists()) return null;
+      final List<dynamic> json = jsonDecode(await file.readAsString());
+      final episodes = json
+          .map((e) => Episode.fromJson(e as List<dynamic>))
+          .toList();
+      return _memory[animeId] ??= episodes;
+    } catch (e) {
+      return null;
+    }
+  }
+
+  /// Stores a freshly fetched list in memory and on disk.
+  Future<void> write(String animeId, List<Episode> episodes) async {
+    _memory[animeId] = episodes;
+    _fetchedAt[animeId] = DateTime.now();
+    try {
+      final file = await _file(animeId);
+      await file.writeAsString(jsonEncode(episodes));
+    } catch (e) {
+      // Silently fail
+    }
+  }
+
+  /// Episodes in [fresh] past the end of [cached], or null when [fresh] is
+  /// not [cached] plus an appended tail and must replace it.
+  static List<Episode>? appended(List<Episode> cached, List<Episode> fresh) {
+    if (fresh.length < cached.length) return null;
+    for (var i = 0; i < cached.length; i++) {
+      if (cached[i].number != fresh[i].number ||
+          cached[i].url != fresh[i].url) {
+        return null;
+      }
+    }
+    return fresh.sublist(cached.length);
+  }
+
+  Future<File> _file(String animeId) async {
+    if (_dir == null) {
+      final support = await getApplicationSupportDirectory();
+      _dir = await Directory('${support.path}/$_dirName').create(recursive: true);
+    }
+    // Show IDs are opaque strings; keep the file name filesystem-safe.
+    final name = base64Url.encode(utf8.encode(animeId));
+    return File('${_dir!.path}/$name.json');
+  }
+}
@@ -0,0 +1,147 @@
+import 'dart:async';
+import 'dart:convert';
+import 'package:flutter/foundation.dart';
+import 'package:shared_preferences/shared_preferences.dart';
+import '../models/anime.dart';
+import '../providers/anime_provider.dart';
+import 'episode_cache.dart';
+
+/// Periodically checks the recently watched shows for new episodes.
+///
+/// Shows are polled in batches through [AnimeProvider.getEpisodesBatch], one
+/// request per [batchSize] shows with [batchGap] between requests, instead of
+/// one `getEpisodes` round-trip per show. The lists it finds are written to
+/// [EpisodeCache] so `DetailsScreen` can open without waiting on the network.
+class EpisodeWatcher {
+  static final EpisodeWatcher instance = EpisodeWatcher();
+
+  static const String _recentKey = 'recent_anime';
+  static const String _countsKey = 'episode_counts';
+
+  final AnimeProvider _provider;
+  final EpisodeCache _cache;
+  final int batchSize;
+  final Duration batchGap;
+
+  // Episode counts the user has already seen, persisted across launches.
+  Map<String, int>? _seenCounts;
+  Timer? _timer;
+  Future<void>? _running;
+
+  /// IDs of recently watched shows that have episodes the user has not seen.
+  final ValueNotifier<Set<String>> newEpisodes = ValueNotifier(const {});
+
+  EpisodeWatcher({
+    AnimeProvider? provider,
+    EpisodeCache? cache,
+    this.batchSize = 8,
+    this.batchGap = const Duration(seconds: 2),
+  })  : _provider = provider ?? AnimeProvider(),
+        _cache = cache ?? EpisodeCache.instance;
+
+  /// Checks now and then every [interval] until [stop] is called.
+  void start({Duration interval = const Duration(minutes: 30)}) {
+    _timer?.cancel();
+    _timer = Timer.periodic(interval, (_) => checkNow());
+    checkNow();
+  }
+
+  void stop() {
+    _timer?.cancel();
+    _timer = null;
+  }
+
+  /// Records that the user has seen every episode currently known for
+  /// [animeId] and clears its new-episode mark.
+  Future<void> markSeen(String animeId, int episodeCount) async {
+    final counts = await _loadSeenCounts();
+    counts[animeId] = episodeCount;
+    if (newEpisodes.value.contains(animeId)) {
+      newEpisodes.value = {...newEpisodes.value}..remove(animeId);
+    }
+    await _saveSeenCounts();
+  }
+
+  /// Runs one pass over the recent shows. Concurrent calls share the pass.
+  Future<void> checkNow() => _running ??= _check().whenComplete(() {
+        _running = null;
+      });
+
+  Future<void> _check() async {
+    final List<String> ids;
+    try {
+      ids = await _recentIds();
+    } catch (e) {
+      return;
+    }
+    if (ids.isEmpty) return;
+
+    final counts = await _loadSeenCounts();
+    // Episode counts of shows that grew during this pass.
+    final found = <String, int>{};
+
+    for (var start = 0; start < ids.length; start += batchSize) {
+      if (start > 0) await Future.delayed(batchGap);
+      final batch = ids.sublist(start, (start + batchSize).clamp(0, ids.length));
+      final Map<String, List<Episode>> lists;
+      try {
+        lists = await _provider.getEpisodesBatch(batch);
+      } catch (e) {
+        // Try again on the next pass
+        continue;
+      }
+      lists.forEach((id, episodes) {
+        _cache.write(id, episodes);
+        final seen = counts[id];
+        if (seen == null) {
+          // First time we see this show: nothing is new yet.
+          counts[id] = episodes.length;
+        } else if (episodes.length > seen) {
+          found[id] = episodes.length;
+        }
+      });
+    }
+
+    // markSeen may have run while the batches were in flight, so compare with
+    // the counts as they are now and merge into the current badges.
+    final fresh = [
+      for (final e in found.entries)
+        if (e.value > (counts[e.key] ?? 0)) e.key,
+    ];
+    if (fresh.isNotEmpty) {
+      newEpisodes.value = {...newEpisodes.value, ...fresh};
+    }
+    await _saveSeenCounts();
+  }
+
+  Future<List<String>> _recentIds() async {
+    final prefs = await SharedPreferences.getInstance();
+    final jsonList = prefs.getStringList(_recentKey) ?? [];
+    return jsonList
+        .map((jsonStr) => jsonDecode(jsonStr)['url'] as String)
+        .toList();
+  }
+
+  Future<Map<String, int>> _loadSeenCounts() async {
+    if (_seenCounts != null) return _seenCounts!;
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      final raw = prefs.getString(_countsKey);
+      _seenCounts = raw == null
+          ? {}
+          : Map<String, int>.from(jsonDecode(raw) as Map<String, dynamic>);
+    } catch (e) {
+      _seenCounts = {};
+    }
+    return _seenCounts!;
+  }
+
+  Future<void> _saveSeenCounts() async {
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      await prefs.setString(_countsKey, jsonEncode(_seenCounts ?? {}));
+    } catch (e) {
+      // Silently fail
+    }
+  }
+}
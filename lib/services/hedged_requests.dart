@@ -0,0 +1,219 @@
+import 'dart:async';
+import 'dart:math';
+import 'package:http/http.dart' as http;
+
+/// Groups of upstream calls that share a timeout and hedging policy.
+enum EndpointClass {
+  /// AllAnime `shows` search.
+  search,
+
+  /// AllAnime `show` episode list for one show.
+  episodes,
+
+  /// Aliased `show` queries for several shows at once, made in the background
+  /// by the episode watcher.
+  episodesBatch,
+
+  /// AllAnime `episode` query that lists a stream's sources.
+  streamLink,
+
+  /// Source lookups on `allanime.day/.../clock.json`.
+  clock,
+
+  /// Redirector hops while resolving the final media URL.
+  redirect,
+
+  /// Jikan requests made through `jikan_api`.
+  jikan,
+}
+
+class RequestPolicy {
+  /// Upper bound for the whole call, hedge included.
+  final Duration timeout;
+
+  /// Whether a duplicate may be sent when the first attempt is slow. Only
+  /// set this for idempotent reads.
+  final bool hedge;
+
+  /// Hedge delay used until enough latencies are known to estimate the p95.
+  final Duration initialHedgeDelay;
+
+  const RequestPolicy({
+    required this.timeout,
+    this.hedge = false,
+    this.initialHedgeDelay = const Duration(milliseconds: 1500),
+  });
+}
+
+/// Counters and recent latencies for one [EndpointClass].
+class HedgeStats {
+  final int _window;
+  final List<Duration> _latencies = [];
+  int requests = 0;
+  int hedges = 0;
+  int hedgeWins = 0;
+  int timeouts = 0;
+
+  HedgeStats._(this._window);
+
+  /// Nearest-rank p95 of recent successful calls, or null while there are
+  /// too few to trust.
+  Duration? get p95 {
+    if (_latencies.length < HedgedRequests.minSamples) return null;
+    final sorted = List.of(_latencies)..sort();
+    return sorted[(sorted.length * 0.95).ceil() - 1];
+  }
+
+  /// Share of requests that sent a hedge.
+  double get hedgeRate => requests == 0 ? 0 : hedges / requests;
+
+  /// Share of hedges that answered before the original request.
+  double get hedgeWinRate => hedges == 0 ? 0 : hedgeWins / hedges;
+
+  Map<String, dynamic> toJson() => {
+        'requests': requests,
+        'hedges': hedges,
+        'hedge_wins': hedgeWins,
+        'timeouts': timeouts,
+        'p95_ms': p95?.inMilliseconds,
+      };
+
+  void _record(Duration latency) {
+    _latencies.add(latency);
+    if (_latencies.length > _window) _latencies.removeAt(0);
+  }
+}
+
+/// GETs with per-endpoint timeouts and hedging for tail latency.
+///
+/// When a hedged request has not answered by the endpoint's observed p95, one
+/// duplicate is sent. The first response wins and the other attempt is
+/// cancelled by closing its client. Hedges draw from a token bucket that
+/// gains [hedgeBudget] tokens per request, so at most that fraction of calls
+/// are ever duplicated, even when the upstream is slow across the board.
+class HedgedRequests {
+  static final HedgedRequests instance = HedgedRequests();
+
+  static const int minSamples = 20;
+
+  static const Map<EndpointClass, RequestPolicy> defaultPolicies = {
+    EndpointClass.search: RequestPolicy(timeout: Duration(seconds: 10), hedge: true),
+    EndpointClass.episodes: RequestPolicy(timeout: Duration(seconds: 10), hedge: true),
+    // Nobody waits on these, and one hedge would repeat every show in the
+    // batch while drawing a single token.
+    EndpointClass.episodesBatch: RequestPolicy(timeout: Duration(seconds: 15)),
+    EndpointClass.streamLink: RequestPolicy(timeout: Duration(seconds: 10), hedge: true),
+    EndpointClass.clock: RequestPolicy(timeout: Duration(seconds: 8), hedge: true),
+    EndpointClass.redirect: RequestPolicy(timeout: Duration(seconds: 8)),
+    // jikan_api requests cannot be cancelled and Jikan is rate limited, so
+    // they are never duplicated.
+    EndpointClass.jikan: RequestPolicy(timeout: Duration(seconds: 15)),
+  };
+
+  final Map<EndpointClass, RequestPolicy> policies;
+  final double hedgeBudget;
+  final double maxHedgeTokens;
+  final int window;
+
+  final Map<EndpointClass, HedgeStats> _stats = {};
+  double _hedgeTokens = 0;
+
+  HedgedRequests({
+    this.policies = defaultPolicies,
+    this.hedgeBudget = 0.1,
+    this.maxHedgeTokens = 10,
+    this.window = 200,
+  });
+
+  RequestPolicy policyFor(EndpointClass endpoint) =>
+      policies[endpoint] ?? defaultPolicies[endpoint]!;
+
+  HedgeStats stats(EndpointClass endpoint) =>
+      _stats.putIfAbsent(endpoint, () => HedgeStats._(window));
+
+  Map<String, dynamic> statsJson() => {
+        for (final e in _stats.entries) e.key.name: e.value.toJson(),
+      };
+
+  Future<http.Response> get(
+    EndpointClass endpoint,
+    Uri url, {
+    Map<String, String>? headers,
+  }) {
+    final policy = policyFor(endpoint);
+    final stats = this.stats(endpoint);
+    stats.requests++;
+    _hedgeTokens = min(maxHedgeTokens, _hedgeTokens + hedgeBudget);
+
+    final stopwatch = Stopwatch()..start();
+    final done = Completer<http.Response>();
+    final attempts = <_Attempt>[];
+    Timer? hedgeTimer;
+    Timer? timeoutTimer;
+
+    void settle() {
+      hedgeTimer?.cancel();
+      timeoutTimer?.cancel();
+      for (final attempt in attempts) {
+        attempt.cancel();
+      }
+    }
+
+    void launch({required bool isHedge}) {
+      final attempt = _Attempt(url, headers);
+      attempts.add(attempt);
+      attempt.response.then(
+        (response) {
+          if (done.isCompleted) return;
+          stats._record(stopwatch.elapsed);
+          if (isHedge) stats.hedgeWins++;
+          settle();
+          done.complete(response);
+        },
+        onError: (Object e, StackTrace stackTrace) {
+          if (done.isCompleted) return;
+          // Wait for the other attempt if one is still running.
+          if (attempts.any((a) => !a.isDone)) return;
+          settle();
+          done.completeError(e, stackTrace);
+        },
+      );
+    }
+
+    launch(isHedge: false);
+    if (policy.hedge) {
+      hedgeTimer = Timer(stats.p95 ?? policy.initialHedgeDelay, () {
+        if (done.isCompleted || _hedgeTokens < 1) return;
+        _hedgeTokens -= 1;
+        stats.hedges++;
+        launch(isHedge: true);
+      });
+    }
+    timeoutTimer = Timer(policy.timeout, () {
+      if (done.isCompleted) return;
+      stats.timeouts++;
+      // Count it as slow, or a hanging upstream would never move the p95.
+      stats._record(policy.timeout);
+      settle();
+      done.completeError(
+        TimeoutException('${endpoint.name} request timed out', policy.timeout),
+      );
+    });
+    return done.future;
+  }
+}
+
+class _Attempt {
+  // One client per attempt, so closing it aborts only this request.
+  final http.Client _client = http.Client();
+  late final Future<http.Response> response;
+  bool isDone = false;
+
+  _Attempt(Uri url, Map<String, String>? headers) {
+    response = _client.get(url, headers: headers).whenComplete(() {
+      isDone = true;
+    });
+  }
+
+  void cancel() => _client.close();
+}
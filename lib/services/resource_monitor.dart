@@ -0,0 +1,258 @@
+import 'dart:async';
+import 'dart:io';
+import 'package:flutter/widgets.dart';
+import 'package:flutter/services.dart';
+import 'package:path_provider/path_provider.dart';
+
+/// CPU used by one native thread since the previous sample.
+class ThreadSample {
+  final int tid;
+  final String name;
+  final double cpuPercent;
+  final int cpuTimeMs;
+
+  const ThreadSample({
+    required this.tid,
+    required this.name,
+    required this.cpuPercent,
+    required this.cpuTimeMs,
+  });
+
+  factory ThreadSample.fromMap(Map<Object?, Object?> map) => ThreadSample(
+        tid: map['tid'] as int,
+        name: map['name'] as String,
+        cpuPercent: (map['cpuPercent'] as num).toDouble(),
+        cpuTimeMs: map['cpuTimeMs'] as int,
+      );
+
+  /// Coarse owner of the thread, used to attribute CPU time: libmpv playback
+  /// and decoding, the Flutter engine's raster, UI and IO (image decoding)
+  /// runners, Dart VM workers, or anything else.
+  String get group {
+    if (name.startsWith('mpv') ||
+        name.startsWith('av:') ||
+        name.startsWith('vo') ||
+        name.startsWith('ao') ||
+        name.startsWith('demux')) {
+      return 'playback';
+    }
+    // Engine threads are "io.flutter.1.raster" and friends, cut to 15 bytes.
+    if (name.startsWith('io.flutter.')) {
+      final runner = name.substring(name.lastIndexOf('.') + 1);
+      if (runner.startsWith('ra')) return 'raster';
+      if (runner.startsWith('ui')) return 'ui';
+      if (runner.startsWith('io')) return 'io';
+    }
+    if (name.startsWith('Dart') || name.startsWith('dart:')) return 'dart';
+    return 'other';
+  }
+}
+
+/// One reading of the process's resource use from the Linux runner plugin.
+///
+/// Memory is in kB; -1 means the kernel did not report the field.
+class ResourceSample {
+  static const List<String> groups = [
+    'playback',
+    'raster',
+    'ui',
+    'io',
+    'dart',
+    'other',
+  ];
+
+  final DateTime timestamp;
+  final int rssKb;
+  final int peakRssKb;
+  final int pssKb;
+  final int pssAnonKb;
+  final int pssFileKb;
+  final int threadCount;
+  final int openFds;
+  final double cpuPercent;
+  final List<ThreadSample> threads;
+
+  const ResourceSample({
+    required this.timestamp,
+    required this.rssKb,
+    required this.peakRssKb,
+    required this.pssKb,
+    required this.pssAnonKb,
+    required this.pssFileKb,
+    required this.threadCount,
+    required this.openFds,
+    required this.cpuPercent,
+    required this.threads,
+  });
+
+  factory ResourceSample.fromMap(Map<Object?, Object?> map) => ResourceSample(
+        timestamp:
+            DateTime.fromMillisecondsSinceEpoch(map['timestampMs'] as int),
+        rssKb: map['rssKb'] as int,
+        peakRssKb: map['peakRssKb'] as int,
+        pssKb: map['pssKb'] as int,
+        pssAnonKb: map['pssAnonKb'] as int,
+        pssFileKb: map['pssFileKb'] as int,
+        threadCount: map['threadCount'] as int,
+        openFds: map['openFds'] as int,
+        cpuPercent: (map['cpuPercent'] as num).toDouble(),
+        threads: [
+          for (final t in map['threads'] as List<Object?>)
+            ThreadSample.fromMap(t as Map<Object?, Object?>),
+        ],
+      );
+
+  /// Thread CPU summed per [ThreadSample.group].
+  Map<String, double> get cpuByGroup {
+    final totals = {for (final g in groups) g: 0.0};
+    for (final thread in threads) {
+      totals[thread.group] = totals[thread.group]! + thread.cpuPercent;
+    }
+    return totals;
+  }
+
+  static String get csvHeader => [
+        'timestamp',
+        'rss_kb',
+        'pss_kb',
+        'pss_anon_kb',
+        'pss_file_kb',
+        'threads',
+        'open_fds',
+        'cpu_percent',
+        for (final g in groups) 'cpu_${g}_percent',
+      ].join(',');
+
+  String toCsvRow() {
+    final byGroup = cpuByGroup;
+    return [
+      timestamp.toIso8601String(),
+      rssKb,
+      pssKb,
+      pssAnonKb,
+      pssFileKb,
+      threadCount,
+      openFds,
+      cpuPercent.toStringAsFixed(1),
+      for (final g in groups) byGroup[g]!.toStringAsFixed(1),
+    ].join(',');
+  }
+}
+
+/// Streams process memory, CPU, thread and file descriptor use from the
+/// Linux runner's `/proc` sampler, optionally appending each sample to a CSV
+/// file for long-session analysis.
+class ResourceMonitor {
+  static final ResourceMonitor instance = ResourceMonitor();
+
+  static const MethodChannel _methods = MethodChannel('anigen/resource_monitor');
+  static const EventChannel _events =
+      EventChannel('anigen/resource_monitor/samples');
+
+  // Rows are written in batches; about half a minute at the default interval.
+  static const int _csvBatchRows = 30;
+
+  /// Only the Linux runner registers the native side.
+  static bool get isSupported => !kIsWeb && Platform.isLinux;
+
+  final ValueNotifier<ResourceSample?> latest = ValueNotifier(null);
+  StreamSubscription<dynamic>? _subscription;
+  AppLifecycleListener? _lifecycle;
+  File? _csvFile;
+  final List<String> _pendingRows = [];
+  Future<void> _csvWrites = Future.value();
+
+  bool get isRunning => _subscription != null;
+
+  /// Where samples are being written, when CSV export is on.
+  String? get csvPath => _csvFile?.path;
+
+  /// Takes a single sample right away.
+  Future<ResourceSample?> sample() async {
+    if (!isSupported) return null;
+    try {
+      final map = await _methods.invokeMapMethod<Object?, Object?>('sample');
+      return map == null ? null : ResourceSample.fromMap(map);
+    } catch (e) {
+      return null;
+    }
+  }
+
+  /// Samples every [interval] until [stop] is called. With [exportCsv], each
+  /// sample is also appended to a new file under the app support directory.
+  Future<void> start({
+    Duration interval = const Duration(seconds: 1),
+    bool exportCsv = false,
+  }) async {
+    if (!isSupported || isRunning) return;
+    try {
+      await _methods.invokeMethod('setInterval', {
+        'intervalMs': interval.inMilliseconds,
+      });
+      if (exportCsv) await _openCsv();
+      // Nothing else stops the monitor, so make sure buffered rows reach the
+      // file when the app goes to the background or exits.
+      _lifecycle = AppLifecycleListener(
+        onStateChange: (state) {
+          if (state == AppLifecycleState.detached) {
+            stop();
+          } else if (state != AppLifecycleState.resumed) {
+            flushCsv();
+          }
+        },
+        onExitRequested: () async {
+          await stop();
+          return AppExitResponse.exit;
+        },
+      );
+      _subscription = _events.receiveBroadcastStream().listen(
+        (event) {
+          final sample = ResourceSample.fromMap(event as Map<Object?, Object?>);
+          latest.value = sample;
+          if (_csvFile != null) {
+            _pendingRows.add(sample.toCsvRow());
+            if (_pendingRows.length >= _csvBatchRows) flushCsv();
+          }
+        },
+        onError: (Object e) {
+          // Keep the last good sample on screen
+        },
+      );
+    } catch (e) {
+      // Silently fail
+    }
+  }
+
+  Future<void> stop() async {
+    await _subscription?.cancel();
+    _subscription = null;
+    _lifecycle?.dispose();
+    _lifecycle = null;
+    await flushCsv();
+    _csvFile = null;
+  }
+
+  /// Appends buffered CSV rows to the export file.
+  Future<void> flushCsv() {
+    final file = _csvFile;
+    if (file == null || _pendingRows.isEmpty) return _csvWrites;
+    final chunk = '${_pendingRows.join('\n')}\n';
+    _pendingRows.clear();
+    // Chained, so batches land in order even if a write is still running.
+    return _csvWrites = _csvWrites
+        .then<void>(
+          (_) => file.writeAsString(chunk, mode: FileMode.append, flush: true),
+        )
+        .catchError((Object e) {
+      // Silently fail
+    });
+  }
+
+  Future<void> _openCsv() async {
+    final dir = await getApplicationSupportDirectory();
+    final stamp = DateTime.now().toIso8601String().replaceAll(':', '-');
+    final file = File('${dir.path}/resource_samples_$stamp.csv');
+    await file.writeAsString('${ResourceSample.csvHeader}\n', flush: true);
+    _csvFile = file;
+  }
+}
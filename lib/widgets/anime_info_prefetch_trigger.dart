@@ -0,0 +1,167 @@
+import 'dart:async';
+import 'package:flutter/foundation.dart';
+import 'package:flutter/material.dart';
+import '../services/anime_info_prefetcher.dart';
+
+/// Wraps a poster card and asks [AnimeInfoPrefetcher] to load its info once
+/// the card has stayed on screen for [dwell], or right away on hover and
+/// long-press.
+///
+/// Visibility is checked after the card is laid out and whenever the lists
+/// it sits in stop scrolling. Nothing runs while the card sits in a hidden tab
+/// or under another route.
+class AnimeInfoPrefetchTrigger extends StatefulWidget {
+  final int? malId;
+  final Widget child;
+  final Duration dwell;
+
+  const AnimeInfoPrefetchTrigger({
+    super.key,
+    required this.malId,
+    required this.child,
+    this.dwell = const Duration(milliseconds: 600),
+  });
+
+  @override
+  State<AnimeInfoPrefetchTrigger> createState() =>
+      _AnimeInfoPrefetchTriggerState();
+}
+
+class _AnimeInfoPrefetchTriggerState extends State<AnimeInfoPrefetchTrigger> {
+  // One per enclosing scrollable, e.g. a home row and the feed around it.
+  List<ValueListenable<bool>> _scrolling = const [];
+  Timer? _dwell;
+  bool _active = true;
+  bool _requested = false;
+  bool _checkScheduled = false;
+
+  @override
+  void didChangeDependencies() {
+    super.didChangeDependencies();
+    // Hidden tabs and covered routes stay mounted but are not being looked
+    // at. Reading both here also brings us back when either changes.
+    _active = TickerMode.of(context) &&
+        (ModalRoute.of(context)?.isCurrent ?? true);
+
+    // The lookup also brings us back here if the list gets a new position.
+    final scrolling = <ValueListenable<bool>>[];
+    var scrollable = Scrollable.maybeOf(context);
+    while (scrollable != null) {
+      scrolling.add(scrollable.position.isScrollingNotifier);
+      scrollable = Scrollable.maybeOf(scrollable.context);
+    }
+    if (!listEquals(scrolling, _scrolling)) {
+      for (final notifier in _scrolling) {
+        notifier.removeListener(_onScrollingChanged);
+      }
+      for (final notifier in scrolling) {
+        notifier.addListener(_onScrollingChanged);
+      }
+      _scrolling = scrolling;
+    }
+
+    if (_active) {
+      _scheduleCheck();
+    } else {
+      _cancelDwell();
+    }
+  }
+
+  @override
+  void didUpdateWidget(AnimeInfoPrefetchTrigger oldWidget) {
+    super.didUpdateWidget(oldWidget);
+    if (oldWidget.malId != widget.malId) {
+      _requested = false;
+      _cancelDwell();
+      _scheduleCheck();
+    }
+  }
+
+  @override
+  void dispose() {
+    _cancelDwell();
+    for (final notifier in _scrolling) {
+      notifier.removeListener(_onScrollingChanged);
+    }
+    super.dispose();
+  }
+
+  bool get _isScrolling => _scrolling.any((notifier) => notifier.value);
+
+  void _onScrollingChanged() {
+    if (_isScrolling) {
+      // Cards flung past do not count; the dwell must be continuous.
+      _cancelDwell();
+    } else {
+      _scheduleCheck();
+    }
+  }
+
+  // Positions are only final once the frame has been laid out; a scroll can
+  // even end from inside layout.
+  void _scheduleCheck() {
+    if (!_active || _checkScheduled || _requested) return;
+    _checkScheduled = true;
+    WidgetsBinding.instance
+      ..addPostFrameCallback((_) {
+        _checkScheduled = false;
+        if (mounted) _check();
+      })
+      ..ensureVisualUpdate();
+  }
+
+  void _check() {
+    if (_requested || widget.malId == null) return;
+    if (!_isVisible()) {
+      _cancelDwell();
+      return;
+    }
+    if (_isScrolling) return;
+    _dwell ??= Timer(widget.dwell, () {
+      _dwell = null;
+      if (mounted && _isVisible()) _prefetch();
+    });
+  }
+
+  void _cancelDwell() {
+    _dwell?.cancel();
+    _dwell = null;
+  }
+
+  bool _isVisible() {
+    if (!_active) return false;
+
+    final box = context.findRenderObject() as RenderBox?;
+    if (box == null || !box.attached || !box.hasSize) return false;
+    final rect = box.localToGlobal(Offset.zero) & box.size;
+    if (!rect.overlaps(Offset.zero & MediaQuery.sizeOf(context))) return false;
+
+    // Off-screen items inside a list's cache extent are built but not shown.
+    final scrollable = Scrollable.maybeOf(context);
+    final viewport = scrollable?.context.findRenderObject() as RenderBox?;
+    if (viewport != null && viewport.attached && viewport.hasSize) {
+      final bounds = viewport.localToGlobal(Offset.zero) & viewport.size;
+      if (!rect.overlaps(bounds)) return false;
+    }
+    return true;
+  }
+
+  void _prefetch() {
+    final malId = widget.malId;
+    if (_requested || malId == null) return;
+    _requested = true;
+    _cancelDwell();
+    AnimeInfoPrefetcher.instance.prefetch(malId);
+  }
+
+  @override
+  Widget build(BuildContext context) {
+    return MouseRegion(
+      onEnter: (_) => _prefetch(),
+      child: GestureDetector(
+        onLongPress: _prefetch,
+        child: widget.child,
+      ),
+    );
+  }
+}
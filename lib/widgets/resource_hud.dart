@@ -0,0 +1,64 @@
+import 'package:flutter/material.dart';
+import '../services/resource_monitor.dart';
+
+/// Debug overlay showing the latest [ResourceMonitor] sample in a corner of
+/// the app. It ignores pointer events, so the UI underneath stays usable.
+class ResourceHud extends StatelessWidget {
+  final Widget child;
+
+  const ResourceHud({super.key, required this.child});
+
+  @override
+  Widget build(BuildContext context) {
+    return Stack(
+      children: [
+        child,
+        Positioned(
+          top: 8,
+          right: 8,
+          child: IgnorePointer(
+            child: ValueListenableBuilder<ResourceSample?>(
+              valueListenable: ResourceMonitor.instance.latest,
+              builder: (context, sample, _) {
+                if (sample == null) return const SizedBox.shrink();
+                return _buildPanel(context, sample);
+              },
+            ),
+          ),
+        ),
+      ],
+    );
+  }
+
+  Widget _buildPanel(BuildContext context, ResourceSample sample) {
+    String mb(int kb) => kb < 0 ? '-' : '${(kb / 1024).toStringAsFixed(0)}M';
+    final busiest = sample.cpuByGroup.entries
+        .where((e) => e.value >= 0.5)
+        .toList()
+      ..sort((a, b) => b.value.compareTo(a.value));
+
+    final lines = [
+      'rss ${mb(sample.rssKb)}  pss ${mb(sample.pssKb)}',
+      'anon ${mb(sample.pssAnonKb)}  file ${mb(sample.pssFileKb)}',
+      'cpu ${sample.cpuPercent.toStringAsFixed(0)}%  '
+          'thr ${sample.threadCount}  fd ${sample.openFds}',
+      for (final group in busiest.take(3))
+        '  ${group.key} ${group.value.toStringAsFixed(0)}%',
+    ];
+
+    return Container(
+      padding: const EdgeInsets.symmetric(horizontal: 8, vertical: 6),
+      decoration: BoxDecoration(
+        color: Colors.black.withOpacity(0.7),
+        borderRadius: BorderRadius.circular(6),
+      ),
+      child: Text(
+        lines.join('\n'),
+        style: Theme.of(context).textTheme.labelSmall?.copyWith(
+              color: Colors.white,
+              height: 1.3,
+            ),
+      ),
+    );
+  }
+}
@@ -0,0 +1,313 @@
+#include "resource_monitor_plugin.h"
+
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr char kMethodChannelName[] = "anigen/resource_monitor";
+constexpr char kEventChannelName[] = "anigen/resource_monitor/samples";
+constexpr guint kDefaultIntervalMs = 1000;
+constexpr guint kMinIntervalMs = 100;
+constexpr guint kMaxIntervalMs = 60 * 1000;
+
+// Parses the "Key:   value [kB]" lines of /proc/self/status and
+// /proc/self/smaps_rollup.
+std::unordered_map<std::string, int64_t> ReadFields(const char* path) {
+  std::unordered_map<std::string, int64_t> fields;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    const size_t colon = line.find(':');
+    if (colon == std::string::npos) continue;
+    fields[line.substr(0, colon)] =
+        std::strtoll(line.c_str() + colon + 1, nullptr, 10);
+  }
+  return fields;
+}
+
+int64_t Lookup(const std::unordered_map<std::string, int64_t>& fields,
+               const char* key) {
+  const auto it = fields.find(key);
+  return it == fields.end() ? -1 : it->second;
+}
+
+// utime + stime, in clock ticks, from a /proc stat file.
+bool ReadCpuTicks(const std::string& path, uint64_t* ticks) {
+  std::ifstream file(path);
+  std::string content;
+  if (!std::getline(file, content)) return false;
+  // The command name may contain spaces and parentheses; fields resume after
+  // the last ')'.
+  const size_t close = content.rfind(')');
+  if (close == std::string::npos) return false;
+  std::istringstream fields(content.substr(close + 1));
+  std::string field;
+  uint64_t utime = 0;
+  uint64_t stime = 0;
+  // Field 3 is the state; utime and stime are fields 14 and 15.
+  for (int index = 3; index <= 15 && fields >> field; index++) {
+    if (index == 14) utime = std::strtoull(field.c_str(), nullptr, 10);
+    if (index == 15) stime = std::strtoull(field.c_str(), nullptr, 10);
+  }
+  *ticks = utime + stime;
+  return true;
+}
+
+std::string ReadThreadName(const std::string& task_dir) {
+  std::ifstream file(task_dir + "/comm");
+  std::string name;
+  std::getline(file, name);
+  return name;
+}
+
+int64_t CountOpenFds() {
+  DIR* dir = opendir("/proc/self/fd");
+  if (dir == nullptr) return -1;
+  int64_t count = 0;
+  while (dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') count++;
+  }
+  closedir(dir);
+  // The directory stream itself holds one descriptor while we count.
+  return count - 1;
+}
+
+// Keeps the previous CPU tick counts so each sample can report usage over the
+// interval since the last one.
+class ResourceSampler {
+ public:
+  FlValue* Sample() {
+    const gint64 now_us = g_get_monotonic_time();
+    const double elapsed_s =
+        last_sample_us_ == 0 ? 0 : (now_us - last_sample_us_) / 1e6;
+    last_sample_us_ = now_us;
+    const auto percent = [&](uint64_t ticks, uint64_t previous) {
+      if (elapsed_s <= 0 || ticks < previous) return 0.0;
+      return 100.0 * (ticks - previous) / ticks_per_second_ / elapsed_s;
+    };
+
+    FlValue* sample = fl_value_new_map();
+    fl_value_set_string_take(sample, "timestampMs",
+                             fl_value_new_int(g_get_real_time() / 1000));
+
+    const auto status = ReadFields("/proc/self/status");
+    fl_value_set_string_take(sample, "rssKb",
+                             fl_value_new_int(Lookup(status, "VmRSS")));
+    fl_value_set_string_take(sample, "peakRssKb",
+                             fl_value_new_int(Lookup(status, "VmHWM")));
+    fl_value_set_string_take(sample, "threadCount",
+                             fl_value_new_int(Lookup(status, "Threads")));
+
+    // PSS splits shared pages between the processes mapping them, so it is
+    // the fairer number when mpv and GL drivers share libraries.
+    const auto rollup = ReadFields("/proc/self/smaps_rollup");
+    fl_value_set_string_take(sample, "pssKb",
+                             fl_value_new_int(Lookup(rollup, "Pss")));
+    fl_value_set_string_take(sample, "pssAnonKb",
+                             fl_value_new_int(Lookup(rollup, "Pss_Anon")));
+    fl_value_set_string_take(sample, "pssFileKb",
+                             fl_value_new_int(Lookup(rollup, "Pss_File")));
+
+    fl_value_set_string_take(sample, "openFds",
+                             fl_value_new_int(CountOpenFds()));
+
+    uint64_t process_ticks = 0;
+    ReadCpuTicks("/proc/self/stat", &process_ticks);
+    fl_value_set_string_take(
+        sample, "cpuPercent",
+        fl_value_new_float(percent(process_ticks, process_ticks_)));
+    process_ticks_ = process_ticks;
+
+    fl_value_set_string_take(sample, "threads", SampleThreads(percent));
+    return sample;
+  }
+
+ private:
+  template <typename Percent>
+  FlValue* SampleThreads(const Percent& percent) {
+    FlValue* threads = fl_value_new_list();
+    std::unordered_map<pid_t, uint64_t> ticks_by_thread;
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) return threads;
+    while (dirent* entry = readdir(dir)) {
+      if (entry->d_name[0] == '.') continue;
+      const pid_t tid = std::atoi(entry->d_name);
+      const std::string task_dir =
+          std::string("/proc/self/task/") + entry->d_name;
+      uint64_t ticks = 0;
+      if (!ReadCpuTicks(task_dir + "/stat", &ticks)) continue;
+      ticks_by_thread[tid] = ticks;
+
+      // Threads started since the last sample used all their ticks in it.
+      const auto previous = thread_ticks_.find(tid);
+      const uint64_t previous_ticks =
+          previous == thread_ticks_.end() ? 0 : previous->second;
+
+      FlValue* thread = fl_value_new_map();
+      fl_value_set_string_take(thread, "tid", fl_value_new_int(tid));
+      fl_value_set_string_take(
+          thread, "name", fl_value_new_string(ReadThreadName(task_dir).c_str()));
+      fl_value_set_string_take(
+          thread, "cpuPercent",
+          fl_value_new_float(percent(ticks, previous_ticks)));
+      fl_value_set_string_take(
+          thread, "cpuTimeMs",
+          fl_value_new_int(static_cast<int64_t>(ticks * 1000 /
+                                                ticks_per_second_)));
+      fl_value_append_take(threads, thread);
+    }
+    closedir(dir);
+    // Exited threads drop out here.
+    thread_ticks_.swap(ticks_by_thread);
+    return threads;
+  }
+
+  const double ticks_per_second_ = sysconf(_SC_CLK_TCK);
+  gint64 last_sample_us_ = 0;
+  uint64_t process_ticks_ = 0;
+  std::unordered_map<pid_t, uint64_t> thread_ticks_;
+};
+
+}  // namespace
+
+G_DECLARE_FINAL_TYPE(ResourceMonitorPlugin, resource_monitor_plugin,
+                     RESOURCE_MONITOR, PLUGIN, GObject)
+
+struct _ResourceMonitorPlugin {
+  GObject parent_instance;
+  // Kept for sending samples. Its handlers get an unowned pointer back to
+  // the plugin, so the two do not keep each other alive.
+  FlEventChannel* event_channel;
+  ResourceSampler* sampler;
+  guint interval_ms;
+  guint timer_id;
+};
+
+G_DEFINE_TYPE(ResourceMonitorPlugin, resource_monitor_plugin, G_TYPE_OBJECT)
+
+static gboolean send_sample_cb(gpointer user_data) {
+  ResourceMonitorPlugin* self = RESOURCE_MONITOR_PLUGIN(user_data);
+  g_autoptr(FlValue) sample = self->sampler->Sample();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_event_channel_send(self->event_channel, sample, nullptr, &error)) {
+    g_warning("Failed to send resource sample: %s", error->message);
+  }
+  return G_SOURCE_CONTINUE;
+}
+
+static void start_sampling(ResourceMonitorPlugin* self) {
+  if (self->timer_id != 0) g_source_remove(self->timer_id);
+  self->timer_id = g_timeout_add(self->interval_ms, send_sample_cb, self);
+}
+
+static void stop_sampling(ResourceMonitorPlugin* self) {
+  if (self->timer_id == 0) return;
+  g_source_remove(self->timer_id);
+  self->timer_id = 0;
+}
+
+static FlMethodResponse* set_interval(ResourceMonitorPlugin* self,
+                                      FlValue* args) {
+  FlValue* interval = fl_value_get_type(args) == FL_VALUE_TYPE_MAP
+                          ? fl_value_lookup_string(args, "intervalMs")
+                          : nullptr;
+  if (interval == nullptr || fl_value_get_type(interval) != FL_VALUE_TYPE_INT) {
+    return FL_METHOD_RESPONSE(fl_method_error_response_new(
+        "bad_args", "intervalMs must be an integer", nullptr));
+  }
+  self->interval_ms = std::max<int64_t>(
+      kMinIntervalMs,
+      std::min<int64_t>(fl_value_get_int(interval), kMaxIntervalMs));
+  if (self->timer_id != 0) start_sampling(self);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(nullptr));
+}
+
+static void method_call_cb(FlMethodChannel* channel, FlMethodCall* method_call,
+                           gpointer user_data) {
+  ResourceMonitorPlugin* self = RESOURCE_MONITOR_PLUGIN(user_data);
+  const gchar* method = fl_method_call_get_name(method_call);
+
+  g_autoptr(FlMethodResponse) response = nullptr;
+  if (strcmp(method, "sample") == 0) {
+    g_autoptr(FlValue) sample = self->sampler->Sample();
+    response = FL_METHOD_RESPONSE(fl_method_success_response_new(sample));
+  } else if (strcmp(method, "setInterval") == 0) {
+    response = set_interval(self, fl_method_call_get_args(method_call));
+  } else {
+    response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
+  }
+
+  g_autoptr(GError) error = nullptr;
+  if (!fl_method_call_respond(method_call, response, &error)) {
+    g_warning("Failed to send method call response: %s", error->message);
+  }
+}
+
+static FlMethodErrorResponse* listen_cb(FlEventChannel* channel, FlValue* args,
+                                        gpointer user_data) {
+  start_sampling(RESOURCE_MONITOR_PLUGIN(user_data));
+  return nullptr;
+}
+
+static FlMethodErrorResponse* cancel_cb(FlEventChannel* channel, FlValue* args,
+                                        gpointer user_data) {
+  stop_sampling(RESOURCE_MONITOR_PLUGIN(user_data));
+  return nullptr;
+}
+
+static void resource_monitor_plugin_dispose(GObject* object) {
+  ResourceMonitorPlugin* self = RESOURCE_MONITOR_PLUGIN(object);
+  stop_sampling(self);
+  delete self->sampler;
+  self->sampler = nullptr;
+  if (self->event_channel != nullptr) {
+    fl_event_channel_set_stream_handlers(self->event_channel, nullptr, nullptr,
+                                         nullptr, nullptr);
+  }
+  g_clear_object(&self->event_channel);
+  G_OBJECT_CLASS(resource_monitor_plugin_parent_class)->dispose(object);
+}
+
+static void resource_monitor_plugin_class_init(
+    ResourceMonitorPluginClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = resource_monitor_plugin_dispose;
+}
+
+static void resource_monitor_plugin_init(ResourceMonitorPlugin* self) {
+  self->sampler = new ResourceSampler();
+  self->interval_ms = kDefaultIntervalMs;
+}
+
+void resource_monitor_plugin_register_with_registrar(
+    FlPluginRegistrar* registrar) {
+  ResourceMonitorPlugin* plugin = RESOURCE_MONITOR_PLUGIN(
+      g_object_new(resource_monitor_plugin_get_type(), nullptr));
+
+  FlBinaryMessenger* messenger = fl_plugin_registrar_get_messenger(registrar);
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+
+  plugin->event_channel = fl_event_channel_new(messenger, kEventChannelName,
+                                               FL_METHOD_CODEC(codec));
+  fl_event_channel_set_stream_handlers(plugin->event_channel, listen_cb,
+                                       cancel_cb, plugin, nullptr);
+
+  // The method channel's handler owns the plugin, as in Flutter's plugin
+  // template, so it is disposed when the engine drops the channel.
+  g_autoptr(FlMethodChannel) method_channel = fl_method_channel_new(
+      messenger, kMethodChannelName, FL_METHOD_CODEC(codec));
+  fl_method_channel_set_method_call_handler(method_channel, method_call_cb,
+                                            g_object_ref(plugin),
+                                            g_object_unref);
+
+  g_object_unref(plugin);
+}
@@ -0,0 +1,17 @@
+#ifndef RUNNER_RESOURCE_MONITOR_PLUGIN_H_
+#define RUNNER_RESOURCE_MONITOR_PLUGIN_H_
+
+#include <flutter_linux/flutter_linux.h>
+
+// Samples this process's memory, CPU, thread and file descriptor usage from
+// /proc and sends it to Dart.
+//
+// Method channel "anigen/resource_monitor":
+//   sample                     returns one sample
+//   setInterval {intervalMs}   changes the streaming interval
+// Event channel "anigen/resource_monitor/samples" sends one sample per
+// interval while Dart is listening.
+void resource_monitor_plugin_register_with_registrar(
+    FlPluginRegistrar* registrar);
+
+#endif  // RUNNER_RESOURCE_MONITOR_PLUGIN_H_
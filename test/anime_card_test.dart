@@ -0,0 +1,21 @@
+import 'package:anigen/models/anime_card.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+void main() {
+  test('interns cards with the same fields', () {
+    final a = AnimeCard(malId: 52991, title: 'Sousou no Frieren', imageUrl: 'x');
+    final b = AnimeCard(malId: 52991, title: 'Sousou no Frieren', imageUrl: 'x');
+    expect(identical(a, b), isTrue);
+
+    final renamed = AnimeCard(malId: 52991, title: 'Frieren', imageUrl: 'x');
+    expect(identical(a, renamed), isFalse);
+    expect(renamed == a, isFalse);
+  });
+
+  test('round-trips through JSON', () {
+    final card = AnimeCard(malId: 5114, title: 'Fullmetal Alchemist: Brotherhood');
+    final copy = AnimeCard.fromJson(card.toJson());
+    expect(copy, card);
+    expect(copy.imageUrl, isNull);
+  });
+}
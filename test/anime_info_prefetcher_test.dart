@@ -0,0 +1,61 @@
+import 'package:anigen/services/anime_info_prefetcher.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'support/mock_upstream_server.dart';
+import 'support/upstream_redirect_client.dart';
+
+void main() {
+  late MockUpstreamServer server;
+
+  setUpAll(() async {
+    server = await MockUpstreamServer.start();
+  });
+
+  tearDownAll(() => server.close());
+
+  setUp(() => server.resetHits());
+
+  Future<void> settle(bool Function() done) async {
+    for (var i = 0; i < 50 && !done(); i++) {
+      await Future.delayed(const Duration(milliseconds: 20));
+    }
+  }
+
+  test('prefetched titles load without another request', () {
+    return withMockUpstream(server, () async {
+      final prefetcher = AnimeInfoPrefetcher(precacheImages: false);
+      addTearDown(prefetcher.dispose);
+      prefetcher.prefetch(52991);
+      await settle(() => prefetcher.cached(52991) != null);
+
+      expect(prefetcher.cached(52991)?.malId, 52991);
+      final before = server.requestCount;
+      final anime = await prefetcher.load(52991);
+      expect(anime.malId, 52991);
+      expect(server.requestCount, before);
+    });
+  });
+
+  test('stops at the per-minute budget', () {
+    return withMockUpstream(server, () async {
+      final prefetcher = AnimeInfoPrefetcher(
+        budgetPerMinute: 2,
+        precacheImages: false,
+      );
+      // Ends the drain's wait for the next minute's budget.
+      addTearDown(prefetcher.dispose);
+      for (final id in const [5114, 9253, 28977]) {
+        prefetcher.prefetch(id);
+      }
+      await settle(() => server.requestCount >= 2);
+      await Future.delayed(const Duration(milliseconds: 200));
+
+      expect(server.requestCount, 2);
+      // 5114 starts at once on an idle lane. After it, the newest queued
+      // title goes next, since the last card looked at is the likeliest tap.
+      expect(prefetcher.cached(5114), isNotNull);
+      expect(prefetcher.cached(28977), isNotNull);
+      expect(prefetcher.cached(9253), isNull);
+    });
+  });
+}
@@ -0,0 +1,120 @@
+// Per-keystroke latency of the local catalog index at 50k titles.
+//
+// Run with `flutter test test/benchmark`.
+
+import 'dart:convert';
+import 'dart:io';
+import 'dart:math';
+
+import 'package:anigen/services/catalog_index.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import '../support/latency_stats.dart';
+
+const _titles = 50000;
+const _baselinePath = 'test/benchmark/baselines/catalog_index.json';
+
+const _syllables = [
+  'ka', 'ki', 'ku', 'ke', 'ko', 'sa', 'shi', 'su', 'se', 'so', 'ta', 'chi',
+  'tsu', 'te', 'to', 'na', 'ni', 'nu', 'ne', 'no', 'ha', 'hi', 'fu', 'he',
+  'ho', 'ma', 'mi', 'mu', 'me', 'mo', 'ya', 'yu', 'yo', 'ra', 'ri', 'ru',
+  're', 'ro', 'wa', 'gen', 'jin', 'kyou', 'shou', 'ryuu', 'sen', 'ten',
+];
+const _words = [
+  'the', 'of', 'hero', 'academy', 'demon', 'slayer', 'sword', 'online',
+  'titan', 'attack', 'journey', 'end', 'world', 'another', 'life', 'season',
+  'part', 'movie', 'final', 'chronicles', 'legend', 'dragon', 'school',
+];
+
+String _word(Random random) =>
+    List.generate(2 + random.nextInt(3), (_) => _syllables[random.nextInt(_syllables.length)]).join();
+
+String _english(Random random) =>
+    List.generate(2 + random.nextInt(3), (_) => _words[random.nextInt(_words.length)]).join(' ');
+
+/// Simulates a user typing [title] with one typo, one keystroke at a time.
+List<String> _keystrokes(String title, Random random) {
+  final chars = title.split('');
+  final typo = random.nextInt(chars.length);
+  chars[typo] = _syllables[random.nextInt(_syllables.length)][0];
+  final typed = chars.join();
+  return [for (var i = 2; i <= min(typed.length, 16); i++) typed.substring(0, i)];
+}
+
+void main() {
+  final baseline = BenchmarkBaseline.load(_baselinePath);
+  final results = <LatencyStats>[];
+  final random = Random(30);
+  final index = CatalogIndex();
+  final titles = <String>[];
+  final entries = <CatalogEntry>[];
+
+  tearDownAll(() {
+    writeBenchmarkReport('catalog_index', results, extra: {'titles': _titles});
+    if (BenchmarkBaseline.updating) baseline.write(results);
+  });
+
+  test('build', () async {
+    final sw = Stopwatch()..start();
+    for (var i = 0; i < _titles; i++) {
+      final title = '${_word(random)} no ${_word(random)}';
+      final entry = CatalogEntry(
+        title: title,
+        altTitles: [_english(random)],
+        allAnimeId: 'show$i',
+      );
+      titles.add(title);
+      entries.add(entry);
+      index.add(entry, persist: false);
+    }
+    final stats = LatencyStats('catalog.build', [sw.elapsed]);
+    results.add(stats);
+    // ignore: avoid_print
+    print(stats);
+    expect(index.length, _titles);
+  });
+
+  // Decoding and rebuilding the postings from a saved file, as at startup.
+  test('load', () async {
+    final dir = Directory.systemTemp.createTempSync('catalog_index');
+    addTearDown(() => dir.deleteSync(recursive: true));
+    final path = '${dir.path}/catalog_index.json';
+    File(path).writeAsStringSync(jsonEncode(entries));
+
+    final loaded = CatalogIndex(path: path);
+    final sw = Stopwatch()..start();
+    await loaded.load();
+    final stats = LatencyStats('catalog.load', [sw.elapsed]);
+    results.add(stats);
+    // ignore: avoid_print
+    print(stats);
+    expect(loaded.length, _titles);
+  });
+
+  test('keystroke search', () async {
+    final queries = [
+      for (var i = 0; i < 40; i++)
+        ..._keystrokes(titles[random.nextInt(titles.length)], random),
+    ];
+    final stats = await measure('catalog.keystroke', queries.length, (i) async {
+      index.search(queries[i]);
+    }, warmup: 20);
+    results.add(stats);
+    // ignore: avoid_print
+    print(stats);
+    if (!BenchmarkBaseline.updating) {
+      expect(baseline.regressions(stats), isEmpty);
+    }
+  });
+
+  test('finds the typed title despite a typo', () {
+    var hits = 0;
+    for (var i = 0; i < 100; i++) {
+      final id = random.nextInt(titles.length);
+      final query = _keystrokes(titles[id], random).last;
+      final matches = index.search(query);
+      if (matches.any((m) => m.entry.allAnimeId == 'show$id')) hits++;
+    }
+    expect(hits, greaterThanOrEqualTo(90));
+  });
+}
@@ -0,0 +1,137 @@
+// Tail latency of AllAnime search with and without hedging, against an
+// upstream where a few requests hang.
+//
+// Run with `flutter test test/benchmark`. No network access is needed.
+
+import 'dart:async';
+
+import 'package:anigen/providers/anime_provider.dart';
+import 'package:anigen/services/hedged_requests.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import '../support/latency_stats.dart';
+import '../support/mock_upstream_server.dart';
+import '../support/upstream_redirect_client.dart';
+
+const _iterations = 80;
+const _spike = Duration(milliseconds: 1500);
+
+// A fast upstream where one request in twenty stalls for 1.5s.
+const _profile = FaultProfile(
+  latency: Duration(milliseconds: 5),
+  jitter: Duration(milliseconds: 2),
+  spikeRate: 0.05,
+  spikeLatency: _spike,
+  seed: 35,
+);
+
+void main() {
+  late MockUpstreamServer server;
+  final results = <LatencyStats>[];
+  final hedgeStats = <String, dynamic>{};
+
+  setUpAll(() async {
+    server = await MockUpstreamServer.start();
+  });
+
+  setUp(() => server.profile = _profile);
+
+  tearDownAll(() async {
+    await server.close();
+    writeBenchmarkReport('hedged_requests', results, extra: {'hedging': hedgeStats});
+  });
+
+  Future<LatencyStats> searchLatency(String name, HedgedRequests requests) async {
+    final provider = AnimeProvider(requests: requests);
+    final stats = await measure(
+      name,
+      _iterations,
+      (_) => withMockUpstream(server, () => provider.search('frieren')),
+      warmup: 0,
+    );
+    results.add(stats);
+    // ignore: avoid_print
+    print(stats);
+    return stats;
+  }
+
+  test('hedging cuts the tail that spikes add', () async {
+    final plain = await searchLatency(
+      'allanime.search.unhedged',
+      HedgedRequests(policies: const {
+        EndpointClass.search: RequestPolicy(timeout: Duration(seconds: 5)),
+      }),
+    );
+
+    final requests = HedgedRequests(
+      policies: const {
+        EndpointClass.search: RequestPolicy(
+          timeout: Duration(seconds: 5),
+          hedge: true,
+          initialHedgeDelay: Duration(milliseconds: 100),
+        ),
+      },
+      hedgeBudget: 0.2,
+    );
+    final hedged = await searchLatency('allanime.search.hedged', requests);
+    final stats = requests.stats(EndpointClass.search);
+    hedgeStats['search'] = stats.toJson();
+    // ignore: avoid_print
+    print('hedges=${stats.hedges} wins=${stats.hedgeWins} p95=${stats.p95}');
+
+    expect(plain.failures + hedged.failures, 0);
+    expect(plain.p99, greaterThanOrEqualTo(_spike.inMilliseconds));
+    expect(hedged.p95, lessThan(_spike.inMilliseconds / 3));
+    expect(stats.hedgeWins, greaterThan(0));
+    expect(stats.hedges, lessThanOrEqualTo((stats.requests * 0.2).floor()));
+  });
+
+  test('no hedges are sent without budget', () async {
+    server.profile = const FaultProfile(
+      spikeRate: 1,
+      spikeLatency: Duration(milliseconds: 200),
+    );
+    final requests = HedgedRequests(
+      policies: const {
+        EndpointClass.search: RequestPolicy(
+          timeout: Duration(seconds: 5),
+          hedge: true,
+          initialHedgeDelay: Duration(milliseconds: 20),
+        ),
+      },
+      hedgeBudget: 0,
+    );
+    final provider = AnimeProvider(requests: requests);
+    server.resetHits();
+    await withMockUpstream(server, () async {
+      for (var i = 0; i < 5; i++) {
+        await provider.search('frieren');
+      }
+    });
+
+    expect(requests.stats(EndpointClass.search).hedges, 0);
+    // One request per search proves no duplicate went out.
+    expect(server.requestCount, 5);
+  });
+
+  test('hung requests time out', () async {
+    server.profile = const FaultProfile(
+      spikeRate: 1,
+      spikeLatency: Duration(seconds: 3),
+    );
+    final requests = HedgedRequests(policies: const {
+      EndpointClass.search: RequestPolicy(timeout: Duration(milliseconds: 200)),
+    });
+    final stopwatch = Stopwatch()..start();
+
+    await expectLater(
+      withMockUpstream(
+        server,
+        () => AnimeProvider(requests: requests).search('frieren'),
+      ),
+      throwsA(isA<TimeoutException>()),
+    );
+    expect(stopwatch.elapsed, lessThan(const Duration(seconds: 1)));
+    expect(requests.stats(EndpointClass.search).timeouts, 1);
+  });
+}
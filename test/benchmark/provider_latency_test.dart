@@ -0,0 +1,142 @@
+// End-to-end latency of the provider layer against the offline upstream.
+//
+// Run with `flutter test test/benchmark`. No network access is needed: every
+// request is answered by MockUpstreamServer from test/fixtures.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:anigen/providers/anime_provider.dart';
+import 'package:anigen/providers/jikan_provider.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import '../support/latency_stats.dart';
+import '../support/mock_upstream_server.dart';
+import '../support/upstream_redirect_client.dart';
+
+const _iterations = 40;
+const _baselinePath = 'test/benchmark/baselines/provider_latency.json';
+
+// A typical 4G link: ~30ms to first byte with jitter and an 8 Mbit/s downlink.
+const _profile = FaultProfile(
+  latency: Duration(milliseconds: 30),
+  jitter: Duration(milliseconds: 10),
+  bytesPerSecond: 1024 * 1024,
+  seed: 26,
+);
+
+void main() {
+  late MockUpstreamServer server;
+  late List<String> showIds;
+  final results = <LatencyStats>[];
+  final baseline = BenchmarkBaseline.load(_baselinePath);
+
+  const queries = ['frieren', 'shingeki', 'kimetsu', 'one piece', 'naruto', 'jujutsu'];
+
+  setUpAll(() async {
+    server = await MockUpstreamServer.start(profile: _profile);
+    final shows = jsonDecode(
+      File('test/fixtures/allanime/show.json').readAsStringSync(),
+    ) as Map<String, dynamic>;
+    showIds = shows.keys.where((k) => k != '*').toList();
+  });
+
+  tearDownAll(() async {
+    await server.close();
+    writeBenchmarkReport('provider_latency', results, extra: {
+      'profile': {
+        'latency_ms': _profile.latency.inMilliseconds,
+        'jitter_ms': _profile.jitter.inMilliseconds,
+        'bytes_per_second': _profile.bytesPerSecond,
+      },
+    });
+    if (BenchmarkBaseline.updating) baseline.write(results);
+  });
+
+  Future<void> bench(String name, Future<void> Function(int i) action) async {
+    final stats = await measure(
+      name,
+      _iterations,
+      (i) => withMockUpstream(server, () => action(i)),
+    );
+    results.add(stats);
+    // ignore: avoid_print
+    print(stats);
+    expect(stats.failures, 0, reason: '$name had failed requests');
+    if (!BenchmarkBaseline.updating) {
+      expect(baseline.regressions(stats), isEmpty);
+    }
+  }
+
+  group('AnimeProvider', () {
+    final provider = AnimeProvider();
+
+    test('search', () async {
+      await bench('allanime.search', (i) async {
+        final results = await provider.search(queries[i % queries.length]);
+        expect(results, isNotEmpty);
+      });
+    });
+
+    test('getEpisodes', () async {
+      await bench('allanime.episodes', (i) async {
+        final episodes = await provider.getEpisodes(showIds[i % showIds.length]);
+        expect(episodes, isNotEmpty);
+      });
+    });
+
+    test('getEpisodesBatch', () async {
+      await bench('allanime.episodes_batch', (_) async {
+        final episodes = await provider.getEpisodesBatch(showIds);
+        expect(episodes.length, showIds.length);
+      });
+    });
+
+    test('time to stream url', () async {
+      await bench('allanime.stream_url', (i) async {
+        final stream = await provider.getStreamLink(showIds[i % showIds.length], '1');
+        expect(stream?['url'], startsWith('https://video.anigen.test/'));
+      });
+    });
+  });
+
+  group('JikanProvider', () {
+    final provider = JikanProvider();
+
+    test('top anime', () async {
+      await bench('jikan.top', (_) async {
+        expect(await provider.getTopAnime(), isNotEmpty);
+      });
+    });
+
+    test('home feed', () async {
+      await bench('jikan.home_feed', (_) async {
+        await Future.wait([
+          provider.getTopAnime(),
+          provider.getSeasonAnime(),
+          provider.getPopularAnime(),
+          provider.getUpcomingAnime(),
+          provider.getAiringToday(),
+          provider.getAnimeGenres(),
+        ]);
+      });
+    });
+
+    test('anime by genre', () async {
+      await bench('jikan.genre', (_) async {
+        expect(await provider.getAnimeByGenre(1), isNotEmpty);
+      });
+    });
+  });
+
+  test('injected failures surface as provider errors', () async {
+    final previous = server.profile;
+    server.profile = const FaultProfile(failureRate: 1);
+    addTearDown(() => server.profile = previous);
+
+    await expectLater(
+      withMockUpstream(server, () => AnimeProvider().search('frieren')),
+      throwsException,
+    );
+  });
+}
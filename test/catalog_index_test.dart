@@ -0,0 +1,84 @@
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:anigen/services/catalog_index.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+void main() {
+  late CatalogIndex index;
+
+  setUp(() {
+    index = CatalogIndex();
+    for (final entry in const [
+      CatalogEntry(title: 'Shingeki no Kyojin', allAnimeId: 'snk'),
+      CatalogEntry(title: 'Sousou no Frieren', allAnimeId: 'frieren'),
+      CatalogEntry(title: 'Naruto: Shippuuden', allAnimeId: 'shippuden'),
+      CatalogEntry(title: 'Kimetsu no Yaiba', allAnimeId: 'kny'),
+      CatalogEntry(
+        title: 'Kimetsu no Yaiba',
+        altTitles: ['Demon Slayer: Kimetsu no Yaiba'],
+        malId: 38000,
+      ),
+    ]) {
+      index.add(entry, persist: false);
+    }
+  });
+
+  String? top(String query) {
+    final matches = index.search(query);
+    return matches.isEmpty ? null : matches.first.entry.allAnimeId;
+  }
+
+  test('folds case, diacritics and romaji long vowels', () {
+    expect(CatalogIndex.normalize('Shingekí no Kyōjin!'), 'shingeki no kyojin');
+    expect(CatalogIndex.normalize('Naruto: Shippuuden'), 'naruto shippuden');
+    expect(top('shingekí'), 'snk');
+    expect(top('naruto shippuden'), 'shippuden');
+  });
+
+  test('tolerates typos and partial words', () {
+    expect(top('shingek'), 'snk');
+    expect(top('frieern'), 'frieren');
+    expect(top('sousou no fri'), 'frieren');
+  });
+
+  test('merges Jikan alternate titles into the playable entry', () {
+    expect(index.length, 4);
+    expect(top('demon slayer'), 'kny');
+  });
+
+  test('ignores unrelated queries', () {
+    expect(index.search('zzzz'), isEmpty);
+  });
+
+  test('only trusts close matches as a stand-in title', () {
+    expect(index.bestMatch('demon slayer')?.entry.allAnimeId, 'kny');
+    expect(index.bestMatch('shingek')?.entry.allAnimeId, 'snk');
+    // Both share a couple of grams with an indexed title, which is enough
+    // to rank it but not to search the network for it instead.
+    expect(index.search('kimchi'), isNotEmpty);
+    expect(index.bestMatch('kimchi'), isNull);
+    expect(index.bestMatch('narnia'), isNull);
+  });
+
+  test('keeps titles added while the saved index loads', () async {
+    final dir = Directory.systemTemp.createTempSync('catalog_index');
+    addTearDown(() => dir.deleteSync(recursive: true));
+    final path = '${dir.path}/catalog_index.json';
+    File(path).writeAsStringSync(jsonEncode(const [
+      CatalogEntry(title: 'Sousou no Frieren', allAnimeId: 'frieren'),
+    ]));
+
+    final restored = CatalogIndex(path: path);
+    final loading = restored.load();
+    restored.add(
+      const CatalogEntry(title: 'Kimetsu no Yaiba', allAnimeId: 'kny'),
+      persist: false,
+    );
+    await loading;
+
+    expect(restored.length, 2);
+    expect(restored.search('frieren').first.entry.allAnimeId, 'frieren');
+    expect(restored.search('kimetsu').first.entry.allAnimeId, 'kny');
+  });
+}
@@ -0,0 +1,27 @@
+import 'package:anigen/models/anime.dart';
+import 'package:anigen/services/episode_cache.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+void main() {
+  List<Episode> episodes(Iterable<String> numbers) =>
+      [for (final n in numbers) Episode(number: n, url: n)];
+
+  test('returns only the appended tail', () {
+    final cached = episodes(['1', '2', '3']);
+    final added = EpisodeCache.appended(cached, episodes(['1', '2', '3', '4']));
+    expect(added?.map((e) => e.number), ['4']);
+    expect(EpisodeCache.appended(cached, cached), isEmpty);
+  });
+
+  test('asks for a full replace when earlier episodes changed', () {
+    final cached = episodes(['1', '2', '3']);
+    expect(EpisodeCache.appended(cached, episodes(['1', '2'])), isNull);
+    expect(EpisodeCache.appended(cached, episodes(['1', '2.5', '3', '4'])), isNull);
+  });
+
+  test('episodes round-trip through JSON', () {
+    final episode = Episode.fromJson(Episode(number: '12.5', url: '12.5').toJson());
+    expect(episode.number, '12.5');
+    expect(episode.url, '12.5');
+  });
+}
@@ -0,0 +1,64 @@
+import 'package:anigen/services/resource_monitor.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+void main() {
+  Map<Object?, Object?> thread(int tid, String name, double cpu) => {
+        'tid': tid,
+        'name': name,
+        'cpuPercent': cpu,
+        'cpuTimeMs': 1000,
+      };
+
+  final Map<Object?, Object?> raw = {
+    'timestampMs': 1700000000000,
+    'rssKb': 512000,
+    'peakRssKb': 600000,
+    'pssKb': 400000,
+    'pssAnonKb': 300000,
+    'pssFileKb': -1,
+    'threadCount': 5,
+    'openFds': 42,
+    'cpuPercent': 55,
+    'threads': [
+      thread(1, 'anigen', 4),
+      thread(2, 'io.flutter.1.ra', 20),
+      thread(3, 'av:h264:df0', 25.5),
+      thread(4, 'mpv/demux', 3),
+      thread(5, 'DartWorker', 2.5),
+    ],
+  };
+
+  test('parses the plugin map', () {
+    final sample = ResourceSample.fromMap(raw);
+    expect(sample.timestamp.millisecondsSinceEpoch, 1700000000000);
+    expect(sample.rssKb, 512000);
+    expect(sample.pssFileKb, -1);
+    expect(sample.cpuPercent, 55.0);
+    expect(sample.threads, hasLength(5));
+    expect(sample.threads[2].cpuPercent, 25.5);
+  });
+
+  test('groups threads by owner, including truncated engine names', () {
+    String group(String name) =>
+        ThreadSample(tid: 0, name: name, cpuPercent: 0, cpuTimeMs: 0).group;
+
+    expect(group('io.flutter.1.ra'), 'raster');
+    expect(group('io.flutter.1.raster'), 'raster');
+    expect(group('io.flutter.1.ui'), 'ui');
+    expect(group('io.flutter.1.io'), 'io');
+    expect(group('av:hevc:df1'), 'playback');
+    expect(group('mpv/vo'), 'playback');
+    expect(group('DartWorker'), 'dart');
+    expect(group('gmain'), 'other');
+  });
+
+  test('sums CPU per group for the CSV row', () {
+    final sample = ResourceSample.fromMap(raw);
+    expect(sample.cpuByGroup['playback'], 28.5);
+    expect(sample.cpuByGroup['raster'], 20.0);
+
+    final columns = sample.toCsvRow().split(',');
+    expect(columns, hasLength(ResourceSample.csvHeader.split(',').length));
+    expect(columns.sublist(7), ['55.0', '28.5', '20.0', '0.0', '0.0', '2.5', '4.0']);
+  });
+}
@@ -0,0 +1,141 @@
+import 'dart:convert';
+import 'dart:io';
+
+/// Latency samples for one benchmarked operation.
+class LatencyStats {
+  final String name;
+  final List<Duration> _samples;
+  final int failures;
+
+  LatencyStats(this.name, List<Duration> samples, {this.failures = 0})
+      : _samples = List.of(samples)..sort();
+
+  int get count => _samples.length;
+
+  /// Nearest-rank percentile in milliseconds, [p] in 0..100.
+  double percentileMs(double p) {
+    if (_samples.isEmpty) return 0;
+    final rank = ((p / 100) * _samples.length).ceil().clamp(1, _samples.length);
+    return _samples[rank - 1].inMicroseconds / 1000;
+  }
+
+  double get p50 => percentileMs(50);
+  double get p95 => percentileMs(95);
+  double get p99 => percentileMs(99);
+
+  Map<String, dynamic> toJson() => {
+        'count': count,
+        'failures': failures,
+        'p50_ms': _round(p50),
+        'p95_ms': _round(p95),
+        'p99_ms': _round(p99),
+        'max_ms': _round(percentileMs(100)),
+      };
+
+  @override
+  String toString() => '$name: n=$count p50=${p50.toStringAsFixed(1)}ms '
+      'p95=${p95.toStringAsFixed(1)}ms p99=${p99.toStringAsFixed(1)}ms '
+      'failures=$failures';
+
+  static double _round(double ms) => (ms * 100).roundToDouble() / 100;
+}
+
+/// Times [iterations] sequential runs of [action].
+Future<LatencyStats> measure(
+  String name,
+  int iterations,
+  Future<void> Function(int iteration) action, {
+  int warmup = 2,
+}) async {
+  for (var i = 0; i < warmup; i++) {
+    await action(i);
+  }
+  final samples = <Duration>[];
+  var failures = 0;
+  for (var i = 0; i < iterations; i++) {
+    final sw = Stopwatch()..start();
+    try {
+      await action(i);
+      samples.add(sw.elapsed);
+    } catch (_) {
+      failures++;
+    }
+  }
+  return LatencyStats(name, samples, failures: failures);
+}
+
+/// Percentile ceilings for a benchmark suite, stored as JSON next to the
+/// suite. Set `ANIGEN_UPDATE_BENCH_BASELINE=1` to rewrite the file from the
+/// current run after an intentional change.
+class BenchmarkBaseline {
+  final String path;
+  final double tolerance;
+  final Map<String, Map<String, dynamic>> operations;
+
+  BenchmarkBaseline._(this.path, this.tolerance, this.operations);
+
+  static bool get updating =>
+      Platform.environment['ANIGEN_UPDATE_BENCH_BASELINE'] == '1';
+
+  static BenchmarkBaseline load(String path) {
+    final file = File(path);
+    if (!file.existsSync()) return BenchmarkBaseline._(path, 0.25, {});
+    final json = jsonDecode(file.readAsStringSync()) as Map<String, dynamic>;
+    return BenchmarkBaseline._(
+      path,
+      (json['tolerance'] as num?)?.toDouble() ?? 0.25,
+      (json['operations'] as Map<String, dynamic>).map(
+        (k, v) => MapEntry(k, Map<String, dynamic>.from(v as Map)),
+      ),
+    );
+  }
+
+  /// Returns a description of every percentile in [stats] that exceeds its
+  /// ceiling by more than [tolerance]; empty when within budget.
+  List<String> regressions(LatencyStats stats) {
+    final ceiling = operations[stats.name];
+    if (ceiling == null) return const [];
+    final found = <String>[];
+    for (final key in const ['p50_ms', 'p95_ms', 'p99_ms']) {
+      final limit = (ceiling[key] as num?)?.toDouble();
+      if (limit == null) continue;
+      final actual = stats.toJson()[key] as double;
+      if (actual > limit * (1 + tolerance)) {
+        found.add('${stats.name} $key ${actual}ms > ${limit}ms '
+            '(+${(tolerance * 100).round()}%)');
+      }
+    }
+    return found;
+  }
+
+  void write(Iterable<LatencyStats> results) {
+    for (final stats in results) {
+      final json = stats.toJson();
+      operations[stats.name] = {
+        for (final key in const ['p50_ms', 'p95_ms', 'p99_ms']) key: json[key],
+      };
+    }
+    File(path).writeAsStringSync(
+      '${const JsonEncoder.withIndent('  ').convert({
+            'tolerance': tolerance,
+            'operations': operations,
+          })}\n',
+    );
+  }
+}
+
+/// Writes [results] to `build/benchmarks/<name>.json` for CI artifacts.
+void writeBenchmarkReport(
+  String name,
+  Iterable<LatencyStats> results, {
+  Map<String, dynamic> extra = const {},
+}) {
+  final dir = Directory('build/benchmarks')..createSync(recursive: true);
+  File('${dir.path}/$name.json').writeAsStringSync(
+    '${const JsonEncoder.withIndent('  ').convert({
+          'generated_at': DateTime.now().toUtc().toIso8601String(),
+          ...extra,
+          'results': {for (final s in results) s.name: s.toJson()},
+        })}\n',
+  );
+}
@@ -0,0 +1,17 @@
+import 'dart:io';
+
+/// Sends plain-http requests for fixture hosts (`*.anigen.test`, used by the
+/// poster URLs in test/fixtures) through a [MockUpstreamServer] acting as a
+/// proxy, so `Image.network` stays offline too.
+class MockUpstreamHttpOverrides extends HttpOverrides {
+  final int port;
+
+  MockUpstreamHttpOverrides(this.port);
+
+  @override
+  HttpClient createHttpClient(SecurityContext? context) {
+    return super.createHttpClient(context)
+      ..findProxy = (uri) =>
+          uri.host.endsWith('.anigen.test') ? 'PROXY 127.0.0.1:$port' : 'DIRECT';
+  }
+}
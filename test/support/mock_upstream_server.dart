@@ -0,0 +1,351 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+import 'dart:math';
+
+/// Network conditions injected by [MockUpstreamServer] into every response.
+class FaultProfile {
+  /// Base time to first byte for every response.
+  final Duration latency;
+
+  /// Uniform +/- jitter applied on top of [latency].
+  final Duration jitter;
+
+  /// Throttles the response body to this many bytes per second when set.
+  final int? bytesPerSecond;
+
+  /// Fraction of requests answered with a 503.
+  final double failureRate;
+
+  /// Fraction of requests whose connection is dropped without a response.
+  final double dropRate;
+
+  /// Fraction of requests held for an extra [spikeLatency], the occasional
+  /// hung request that dominates tail latency.
+  final double spikeRate;
+
+  final Duration spikeLatency;
+
+  final int seed;
+
+  const FaultProfile({
+    this.latency = Duration.zero,
+    this.jitter = Duration.zero,
+    this.bytesPerSecond,
+    this.failureRate = 0,
+    this.dropRate = 0,
+    this.spikeRate = 0,
+    this.spikeLatency = const Duration(seconds: 5),
+    this.seed = 0,
+  });
+
+  static const FaultProfile none = FaultProfile();
+}
+
+/// Local stand-in for every upstream host the app talks to.
+///
+/// Requests arrive either through [UpstreamRedirectClient], which keeps the
+/// original host in the `x-upstream-host` header, or as plain-http proxy
+/// requests (images), where the `Host` header names the upstream. Responses
+/// are replayed from the JSON fixtures under `test/fixtures`.
+class MockUpstreamServer {
+  static const String allAnimeApiHost = 'api.allanime.day';
+  static const String allAnimeHost = 'allanime.day';
+  static const String jikanHost = 'api.jikan.moe';
+  static const String imageHost = 'cdn.anigen.test';
+  static const Set<String> redirectorHosts = {'uns.bio', 'redirect.anigen.test'};
+
+  final HttpServer _server;
+  final _Fixtures _fixtures;
+  FaultProfile _profile;
+  Random _random;
+  final Map<String, int> _hits = {};
+
+  MockUpstreamServer._(this._server, this._fixtures, this._profile)
+      : _random = Random(_profile.seed);
+
+  static Future<MockUpstreamServer> start({
+    FaultProfile profile = FaultProfile.none,
+    String fixturesDir = 'test/fixtures',
+  }) async {
+    final fixtures = await _Fixtures.load(fixturesDir);
+    final server = await HttpServer.bind(InternetAddress.loopbackIPv4, 0);
+    final mock = MockUpstreamServer._(server, fixtures, profile);
+    server.listen((request) {
+      // Clients may hang up mid-response, e.g. a cancelled hedge.
+      mock._handle(request).catchError((Object _) {});
+    });
+    return mock;
+  }
+
+  Uri get uri => Uri(scheme: 'http', host: _server.address.host, port: _server.port);
+
+  int get port => _server.port;
+
+  FaultProfile get profile => _profile;
+
+  set profile(FaultProfile value) {
+    _profile = value;
+    _random = Random(value.seed);
+  }
+
+  /// Request counts keyed by `<host><path>`.
+  Map<String, int> get hits => Map.unmodifiable(_hits);
+
+  int get requestCount => _hits.values.fold(0, (sum, n) => sum + n);
+
+  void resetHits() => _hits.clear();
+
+  Future<void> close() => _server.close(force: true);
+
+  Future<void> _handle(HttpRequest request) async {
+    final host = (request.headers.value('x-upstream-host') ??
+            request.headers.host ??
+            request.uri.host)
+        .toLowerCase();
+    final path = request.uri.path;
+    _hits.update('$host$path', (n) => n + 1, ifAbsent: () => 1);
+
+    final profile = _profile;
+    final roll = _random.nextDouble();
+    final delay = _delayFor(profile);
+    if (delay > Duration.zero) {
+      await Future.delayed(delay);
+    }
+
+    if (roll < profile.dropRate) {
+      final socket = await request.response.detachSocket(writeHeaders: false);
+      socket.destroy();
+      return;
+    }
+    if (roll < profile.dropRate + profile.failureRate) {
+      await _send(request, 503, 'text/plain', utf8.encode('injected failure'));
+      return;
+    }
+
+    try {
+      await _route(request, host, path);
+    } catch (e) {
+      await _send(request, 500, 'text/plain', utf8.encode('mock error: $e'));
+    }
+  }
+
+  Duration _delayFor(FaultProfile profile) {
+    final jitterUs = profile.jitter.inMicroseconds;
+    final offset = jitterUs == 0 ? 0 : _random.nextInt(2 * jitterUs + 1) - jitterUs;
+    var us = profile.latency.inMicroseconds + offset;
+    // Only roll when spikes are on, so other profiles keep their sequence.
+    if (profile.spikeRate > 0 && _random.nextDouble() < profile.spikeRate) {
+      us += profile.spikeLatency.inMicroseconds;
+    }
+    return Duration(microseconds: max(0, us));
+  }
+
+  Future<void> _route(HttpRequest request, String host, String path) async {
+    if (host == allAnimeApiHost && path == '/api') {
+      return _sendJson(request, _fixtures.graphQl(request.uri.queryParameters));
+    }
+    if (host == allAnimeHost && path.endsWith('/clock.json')) {
+      final id = request.uri.queryParameters['id'] ?? '*';
+      return _sendJson(request, _fixtures.lookup(_fixtures.clock, id));
+    }
+    if (redirectorHosts.contains(host)) {
+      final location = _fixtures.redirects[path];
+      if (location == null) {
+        return _send(request, 404, 'text/plain', utf8.encode('no redirect'));
+      }
+      request.response.headers.set(HttpHeaders.locationHeader, location);
+      return _send(request, 302, 'text/plain', const []);
+    }
+    if (host == jikanHost && path.startsWith('/v4/')) {
+      final body = _fixtures.jikan(path.substring(3), request.uri.queryParameters);
+      if (body == null) {
+        return _send(request, 404, 'application/json', utf8.encode('{"status":404}'));
+      }
+      return _sendJson(request, body);
+    }
+    if (host == imageHost) {
+      return _send(request, 200, 'image/png', _fixtures.poster);
+    }
+    // Anything else is treated as the final media URL of a stream.
+    return _send(request, 200, 'video/mp4', const [0, 0, 0, 24]);
+  }
+
+  Future<void> _sendJson(HttpRequest request, Object body) {
+    return _send(request, 200, 'application/json', utf8.encode(jsonEncode(body)));
+  }
+
+  Future<void> _send(
+    HttpRequest request,
+    int status,
+    String contentType,
+    List<int> body,
+  ) async {
+    final response = request.response
+      ..statusCode = status
+      ..headers.contentType = ContentType.parse(contentType)
+      ..contentLength = body.length;
+
+    final bps = _profile.bytesPerSecond;
+    if (bps == null || body.isEmpty) {
+      response.add(body);
+    } else {
+      // Pace the body in 50ms slices to approximate a constrained link.
+      final slice = max(1, bps ~/ 20);
+      for (var offset = 0; offset < body.length; offset += slice) {
+        response.add(body.sublist(offset, min(body.length, offset + slice)));
+        await response.flush();
+        if (offset + slice < body.length) {
+          await Future.delayed(const Duration(milliseconds: 50));
+        }
+      }
+    }
+    await response.close();
+  }
+}
+
+class _Fixtures {
+  final Map<String, dynamic> shows;
+  final Map<String, dynamic> show;
+  final Map<String, dynamic> episode;
+  final Map<String, dynamic> clock;
+  final Map<String, String> redirects;
+  final List<Map<String, dynamic>> anime;
+  final Map<String, dynamic> genres;
+  final List<int> poster;
+
+  _Fixtures({
+    required this.shows,
+    required this.show,
+    required this.episode,
+    required this.clock,
+    required this.redirects,
+    required this.anime,
+    required this.genres,
+    required this.poster,
+  });
+
+  static Future<_Fixtures> load(String dir) async {
+    Future<dynamic> json(String name) async =>
+        jsonDecode(await File('$dir/$name').readAsString());
+
+    return _Fixtures(
+      shows: await json('allanime/shows.json'),
+      show: await json('allanime/show.json'),
+      episode: await json('allanime/episode.json'),
+      clock: await json('allanime/clock.json'),
+      redirects: Map<String, String>.from(await json('allanime/redirects.json')),
+      anime: List<Map<String, dynamic>>.from(await json('jikan/anime.json')),
+      genres: await json('jikan/genres.json'),
+      poster: await File('$dir/images/poster.png').readAsBytes(),
+    );
+  }
+
+  dynamic lookup(Map<String, dynamic> table, String key) => table[key] ?? table['*'];
+
+  Object graphQl(Map<String, String> params) {
+    final query = params['query'] ?? '';
+    final variables = jsonDecode(params['variables'] ?? '{}') as Map<String, dynamic>;
+
+    if (query.contains('shows(')) {
+      final search = variables['search'] as Map<String, dynamic>? ?? const {};
+      final term = (search['query'] as String? ?? '').toLowerCase().trim();
+      return lookup(shows, term);
+    }
+    if (query.contains('episode(')) {
+      return lookup(episode, '${variables['showId']}/${variables['episodeString']}');
+    }
+    final aliased = RegExp(r'(\w+): show\( _id: \$(\w+) \)').allMatches(query);
+    if (aliased.isNotEmpty) {
+      return {
+        'data': {
+          for (final m in aliased)
+            m.group(1)!: show[variables[m.group(2)]]?['data']?['show'],
+        },
+      };
+    }
+    if (query.contains('show(')) {
+      return lookup(show, variables['showId'] as String? ?? '*');
+    }
+    return {
+      'errors': [
+        {'message': 'unsupported query'},
+      ],
+    };
+  }
+
+  /// Serves the handful of Jikan v4 endpoints used by `jikan_api`, paging
+  /// through the recorded catalog the same way the real API does.
+  Object? jikan(String path, Map<String, String> params) {
+    final page = int.tryParse(params['page'] ?? '') ?? 1;
+
+    final single = RegExp(r'^/anime/(\d+)(/full)?$').firstMatch(path);
+    if (single != null) {
+      final id = int.parse(single.group(1)!);
+      final entry = anime.where((a) => a['mal_id'] == id).firstOrNull;
+      if (entry == null) return null;
+      return {
+        'data': {
+          ...entry,
+          'relations': [],
+          'theme': {'openings': [], 'endings': []},
+          'external': [],
+          'streaming': [],
+        },
+      };
+    }
+
+    if (path == '/genres/anime') return genres;
+
+    Iterable<Map<String, dynamic>> items;
+    if (path == '/top/anime') {
+      final byPopularity = params['filter'] == 'bypopularity';
+      final list = anime.where((a) => a['status'] != 'Not yet aired').toList();
+      list.sort((a, b) => byPopularity
+          ? (a['popularity'] as int).compareTo(b['popularity'] as int)
+          : (a['rank'] as int).compareTo(b['rank'] as int));
+      items = list;
+    } else if (path == '/seasons/upcoming') {
+      items = anime.where((a) => a['status'] == 'Not yet aired');
+    } else if (RegExp(r'^/seasons/\d+/\w+$').hasMatch(path)) {
+      items = anime.where((a) => a['airing'] == true);
+    } else if (path == '/schedules') {
+      final day = params['filter'];
+      items = anime.where((a) {
+        final broadcast = a['broadcast']?['day'] as String?;
+        return broadcast != null &&
+            (day == null || broadcast.toLowerCase().startsWith(day.toLowerCase()));
+      });
+    } else if (path == '/anime') {
+      final genreIds = (params['genres'] ?? '')
+          .split(',')
+          .where((g) => g.isNotEmpty)
+          .map(int.parse)
+          .toSet();
+      final list = anime.where((a) {
+        final ids = (a['genres'] as List).map((g) => g['mal_id'] as int).toSet();
+        return ids.containsAll(genreIds);
+      }).toList();
+      if (params['order_by'] == 'score') {
+        list.sort((a, b) => ((b['score'] ?? 0) as num).compareTo((a['score'] ?? 0) as num));
+      }
+      items = list;
+    } else {
+      return null;
+    }
+
+    const perPage = 25;
+    final all = items.toList();
+    final pageItems = all.skip((page - 1) * perPage).take(perPage).toList();
+    final lastPage = max(1, (all.length / perPage).ceil());
+    return {
+      'pagination': {
+        'last_visible_page': lastPage,
+        'has_next_page': page < lastPage,
+        'current_page': page,
+        'items': {'count': pageItems.length, 'total': all.length, 'per_page': perPage},
+      },
+      'data': pageItems,
+    };
+  }
+}
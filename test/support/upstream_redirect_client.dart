@@ -0,0 +1,52 @@
+import 'package:http/http.dart' as http;
+import 'package:http/io_client.dart';
+
+import 'mock_upstream_server.dart';
+
+/// Sends every request to a [MockUpstreamServer] while keeping the original
+/// host in the `x-upstream-host` header, so providers can keep their
+/// production URLs.
+class UpstreamRedirectClient extends http.BaseClient {
+  final Uri target;
+  // IOClient directly: inside [withMockUpstream] `http.Client()` resolves back
+  // to this class.
+  final http.Client _inner = IOClient();
+
+  UpstreamRedirectClient(this.target);
+
+  @override
+  Future<http.StreamedResponse> send(http.BaseRequest request) {
+    final rewritten = http.StreamedRequest(
+      request.method,
+      request.url.replace(
+        scheme: target.scheme,
+        host: target.host,
+        port: target.port,
+      ),
+    )
+      ..followRedirects = request.followRedirects
+      ..maxRedirects = request.maxRedirects
+      ..persistentConnection = request.persistentConnection
+      ..headers.addAll(request.headers)
+      ..headers['x-upstream-host'] = request.url.host;
+
+    request.finalize().listen(
+          rewritten.sink.add,
+          onError: rewritten.sink.addError,
+          onDone: rewritten.sink.close,
+        );
+    return _inner.send(rewritten);
+  }
+
+  @override
+  void close() => _inner.close();
+}
+
+/// Runs [body] with every `package:http` call (including the ones made inside
+/// `jikan_api`) routed to [server].
+Future<T> withMockUpstream<T>(
+  MockUpstreamServer server,
+  Future<T> Function() body,
+) {
+  return http.runWithClient(body, () => UpstreamRedirectClient(server.uri));
+}
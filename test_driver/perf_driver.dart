@@ -0,0 +1,55 @@
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:flutter_driver/flutter_driver.dart' as driver;
+import 'package:integration_test/integration_test_driver.dart';
+
+const _outputDir = 'build/benchmarks';
+
+const _summaryKeys = [
+  'frame_count',
+  'average_frame_build_time_millis',
+  '90th_percentile_frame_build_time_millis',
+  '99th_percentile_frame_build_time_millis',
+  'worst_frame_build_time_millis',
+  'missed_frame_build_budget_count',
+  'average_frame_rasterizer_time_millis',
+  '90th_percentile_frame_rasterizer_time_millis',
+  '99th_percentile_frame_rasterizer_time_millis',
+  'worst_frame_rasterizer_time_millis',
+  'missed_frame_rasterizer_budget_count',
+];
+
+/// Turns each timeline recorded by `traceAction` into a full summary file and
+/// collects the headline numbers into `scroll_frames.json`.
+Future<void> main() {
+  return integrationDriver(
+    responseDataCallback: (data) async {
+      if (data == null) return;
+      final scenarios = <String, dynamic>{};
+      for (final entry in data.entries) {
+        final timeline = driver.Timeline.fromJson(
+          entry.value as Map<String, dynamic>,
+        );
+        final summary = driver.TimelineSummary.summarize(timeline);
+        await summary.writeTimelineToFile(
+          entry.key,
+          destinationDirectory: _outputDir,
+          pretty: true,
+        );
+        final json = summary.summaryJson;
+        scenarios[entry.key] = {
+          for (final key in _summaryKeys)
+            if (json.containsKey(key)) key: json[key],
+        };
+      }
+      await Directory(_outputDir).create(recursive: true);
+      await File('$_outputDir/scroll_frames.json').writeAsString(
+        '${const JsonEncoder.withIndent('  ').convert({
+              'generated_at': DateTime.now().toUtc().toIso8601String(),
+              'scenarios': scenarios,
+            })}\n',
+      );
+    },
+  );
+}